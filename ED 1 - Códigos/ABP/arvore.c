@@ -1,37 +1,178 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include "arvore.h"
 
 // Estrutura da Árvore Binária de Pesquisa (ABP)
 typedef struct No {
   int dado;
+  ArvoreArena *arena; // Arena dona do nó (NULL: nó avulso, liberado com 'free')
   struct No* direita;
   struct No* esquerda;
 } *Arvore;
 
+// Bloco contíguo de nós entregues pela arena
+typedef struct Bloco {
+  struct Bloco *prox;
+  size_t usados;
+  size_t capacidade;
+  struct No nos[];
+} Bloco;
+
+// Arena de nós: aloca em blocos e reaproveita os nós removidos
+typedef struct ArvoreArena {
+  Bloco *blocos;
+  size_t nosPorBloco;
+  Arvore livres; // Lista de nós removidos, encadeados pela direita
+  ArvoreArenaEstatisticas estatisticas;
+} ArvoreArena;
+
+// Garante que o bloco atual da arena tenha 'qtd' nós livres e contíguos
+static Bloco *arenaReserva(ArvoreArena *arena, size_t qtd) {
+  Bloco *bloco = arena->blocos;
+  if (bloco != NULL && bloco->capacidade - bloco->usados >= qtd) return bloco;
+  size_t capacidade = (qtd > arena->nosPorBloco) ? qtd : arena->nosPorBloco;
+  bloco = (Bloco *)malloc(sizeof(Bloco) + capacidade * sizeof(struct No));
+  if (bloco == NULL) return NULL;
+  bloco->usados = 0;
+  bloco->capacidade = capacidade;
+  bloco->prox = arena->blocos;
+  arena->blocos = bloco;
+  arena->estatisticas.blocos++;
+  arena->estatisticas.bytes += sizeof(Bloco) + capacidade * sizeof(struct No);
+  return bloco;
+}
+
+// Cria um nó, usando a arena quando ela for informada
+static Arvore noCria(ArvoreArena *arena, const int dado) {
+  Arvore no;
+  if (arena == NULL) no = (Arvore)malloc(sizeof(struct No));
+  else if (arena->livres != NULL) { // Reaproveita um nó removido
+    no = arena->livres;
+    arena->livres = no->direita;
+    arena->estatisticas.nosLivres--;
+  } else {
+    Bloco *bloco = arenaReserva(arena, 1); // Se o bloco atual estiver cheio, aloca um novo
+    if (bloco == NULL) return NULL;
+    no = &bloco->nos[bloco->usados++];
+    arena->estatisticas.nosAlocados++;
+  }
+  if (no == NULL) return NULL;
+  no->dado = dado;
+  no->arena = arena;
+  no->esquerda = NULL;
+  no->direita = NULL;
+  if (arena != NULL) arena->estatisticas.nosEmUso++;
+  return no;
+}
+
+// Descarta um nó: nós avulsos são liberados; nós de arena voltam à lista de livres da própria arena
+static void noLibera(Arvore no) {
+  ArvoreArena *arena = no->arena;
+  if (arena == NULL) {
+    free(no);
+    return;
+  }
+  no->direita = arena->livres;
+  arena->livres = no;
+  arena->estatisticas.nosEmUso--;
+  arena->estatisticas.nosLivres++;
+}
+
+// Item da pilha auxiliar dos percursos iterativos
+typedef struct {
+  Arvore no;
+  int nivel;
+} ItemPilha;
+
+// Pilha auxiliar: usa o vetor local e só aloca se a árvore for muito profunda
+typedef struct {
+  ItemPilha *itens;
+  size_t tam;
+  size_t cap;
+  ItemPilha local[64];
+} PilhaNos;
+
+static void pilhaNosCria(PilhaNos *pilha) {
+  pilha->itens = pilha->local;
+  pilha->tam = 0;
+  pilha->cap = sizeof(pilha->local) / sizeof(pilha->local[0]);
+}
+
+static int pilhaNosEmpilha(PilhaNos *pilha, Arvore no, int nivel) {
+  if (pilha->tam == pilha->cap) { // Dobra a capacidade quando a pilha enche
+    ItemPilha *itens = (pilha->itens == pilha->local) ? malloc(2 * pilha->cap * sizeof(ItemPilha)) : realloc(pilha->itens, 2 * pilha->cap * sizeof(ItemPilha));
+    if (itens == NULL) return 0;
+    if (pilha->itens == pilha->local) for (size_t i = 0; i < pilha->tam; i++) itens[i] = pilha->local[i];
+    pilha->itens = itens;
+    pilha->cap *= 2;
+  }
+  pilha->itens[pilha->tam++] = (ItemPilha){no, nivel};
+  return 1;
+}
+
+static void pilhaNosLibera(PilhaNos *pilha) {
+  if (pilha->itens != pilha->local) free(pilha->itens);
+}
+
 // Cria uma nova árvore vazia
 Arvore arvoreCria() {
   return NULL;
 }
 
-// Libera a memória alocada para uma árvore
+// Cria uma arena que entrega nós em blocos contíguos de 'nosPorBloco' nós
+ArvoreArena *arvoreArenaCria(size_t nosPorBloco) {
+  ArvoreArena *arena = (ArvoreArena *)malloc(sizeof(ArvoreArena));
+  if (arena == NULL) return NULL;
+  arena->blocos = NULL;
+  arena->nosPorBloco = (nosPorBloco > 0) ? nosPorBloco : ARVORE_ARENA_BLOCO_PADRAO;
+  arena->livres = NULL;
+  arena->estatisticas = (ArvoreArenaEstatisticas){0};
+  return arena;
+}
+
+// Libera a arena e todos os seus nós de uma vez, em O(blocos)
+ArvoreArena *arvoreArenaLibera(ArvoreArena *arena) {
+  if (arena == NULL) return NULL;
+  Bloco *bloco = arena->blocos;
+  while (bloco != NULL) { // Libera cada bloco inteiro, sem percorrer a árvore
+    Bloco *prox = bloco->prox;
+    free(bloco);
+    bloco = prox;
+  }
+  free(arena);
+  return NULL;
+}
+
+// Retorna as estatísticas de alocação da arena
+ArvoreArenaEstatisticas arvoreArenaEstatisticas(const ArvoreArena *arena) {
+  if (arena == NULL) return (ArvoreArenaEstatisticas){0};
+  return arena->estatisticas;
+}
+
+// Libera a memória alocada para uma árvore; os nós de arena voltam p/ a sua arena
 Arvore arvoreLibera(Arvore arvore) {
-  if (arvore != NULL) { // Verifica o nó não é vazio
-    arvoreLibera(arvore->esquerda); // Libera o lado esquerdo
-    arvoreLibera(arvore->direita); // Libera o lado direito
-    free(arvore); // Libera a árvore em si
+  while (arvore != NULL) { // Rotaciona à direita até não haver filho esquerdo, liberando sem pilha
+    if (arvore->esquerda != NULL) {
+      Arvore esquerda = arvore->esquerda;
+      arvore->esquerda = esquerda->direita;
+      esquerda->direita = arvore;
+      arvore = esquerda;
+    } else {
+      Arvore direita = arvore->direita;
+      noLibera(arvore); // Libera o nó em si (ou o devolve à arena)
+      arvore = direita;
+    }
   }
   return NULL;
 }
 
-// Insere um elemento na árvore
-Arvore arvoreInsere(Arvore arvore, const int dado) {
+// Insere um elemento na árvore, alocando o nó pela arena (se houver)
+static Arvore insereNo(ArvoreArena *arena, Arvore arvore, const int dado) {
   // Cria um nó para o novo elemento 
-  Arvore no = (Arvore)malloc(sizeof(struct No));
+  Arvore no = noCria(arena, dado);
   if (no == NULL) return arvore;
-  no->dado = dado;
-  no->esquerda = NULL;
-  no->direita = NULL;
 
   if (arvore == NULL) return no; // Se a árvore está vazia, o novo nó é a raiz
   Arvore atual = arvore;
@@ -46,6 +187,76 @@ Arvore arvoreInsere(Arvore arvore, const int dado) {
   return arvore;
 }
 
+// Insere um elemento na árvore
+Arvore arvoreInsere(Arvore arvore, const int dado) {
+  return insereNo(NULL, arvore, dado);
+}
+
+// Insere um elemento na árvore usando um nó da arena
+Arvore arvoreInsereArena(ArvoreArena *arena, Arvore arvore, const int dado) {
+  return insereNo(arena, arvore, dado);
+}
+
+// Compara dois inteiros para o 'qsort'
+static int comparaInt(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+// Monta a subárvore balanceada de v[0..n-1] em pré-ordem, usando 'nos' (se houver) como bloco contíguo
+static Arvore constroiNo(ArvoreArena *arena, struct No *nos, size_t *usados, const int *v, size_t n) {
+  if (n == 0) return NULL;
+  size_t meio = n / 2; // O elemento do meio vira a raiz da subárvore
+  Arvore no = (nos != NULL) ? &nos[(*usados)++] : noCria(NULL, v[meio]);
+  if (no == NULL) return NULL;
+  no->dado = v[meio];
+  no->arena = arena;
+  no->esquerda = constroiNo(arena, nos, usados, v, meio);
+  no->direita = constroiNo(arena, nos, usados, v + meio + 1, n - meio - 1);
+  if ((meio > 0 && no->esquerda == NULL) || (n - meio - 1 > 0 && no->direita == NULL)) { // Falha de alocação em algum dos lados
+    arvoreLibera(no);
+    return NULL;
+  }
+  return no;
+}
+
+// Constrói a árvore balanceada a partir do vetor, ordenando uma cópia se necessário
+static Arvore constroiArvore(ArvoreArena *arena, const int *v, size_t n) {
+  if (v == NULL || n == 0) return NULL;
+  int *copia = NULL;
+  size_t i = 1;
+  while (i < n && v[i - 1] <= v[i]) i++; // Verifica se o vetor já está ordenado
+  if (i < n) { // Senão, ordena uma cópia
+    copia = (int *)malloc(n * sizeof(int));
+    if (copia == NULL) return NULL;
+    for (i = 0; i < n; i++) copia[i] = v[i];
+    qsort(copia, n, sizeof(int), comparaInt);
+    v = copia;
+  }
+  Arvore arvore;
+  size_t usados = 0;
+  if (arena == NULL) arvore = constroiNo(NULL, NULL, &usados, v, n);
+  else { // Todos os nós saem de um único trecho contíguo da arena
+    Bloco *bloco = arenaReserva(arena, n);
+    arvore = (bloco != NULL) ? constroiNo(arena, &bloco->nos[bloco->usados], &usados, v, n) : NULL;
+    if (bloco != NULL) bloco->usados += usados;
+    arena->estatisticas.nosAlocados += usados;
+    arena->estatisticas.nosEmUso += usados;
+  }
+  free(copia);
+  return arvore;
+}
+
+// Constrói uma árvore perfeitamente balanceada a partir de um vetor
+Arvore arvoreConstroi(const int *v, size_t n) {
+  return constroiArvore(NULL, v, n);
+}
+
+// Constrói uma árvore perfeitamente balanceada a partir de um vetor, com todos os nós em uma única alocação da arena
+Arvore arvoreConstroiArena(ArvoreArena *arena, const int *v, size_t n) {
+  return constroiArvore(arena, v, n);
+}
+
 // Busca um elemento na árvore
 Arvore arvoreBusca(Arvore arvore, const int dado) {
   Arvore atual = arvore;
@@ -69,54 +280,94 @@ Arvore encontraMaximo(Arvore arvore) {
   return arvore;
 }
 
-// Remove um elemento da árvore
-Arvore arvoreRemove(Arvore arvore, const int dado) {
+// Remove um elemento da árvore, devolvendo o nó à sua arena (se houver)
+static Arvore removeNo(Arvore arvore, const int dado) {
   if (arvore == NULL) return NULL; // Verifica se a árvore é vazia
-  if (dado < arvore->dado) arvore->esquerda = arvoreRemove(arvore->esquerda, dado); // Se o elemento é menor, remove pela esquerda
-  else if (dado > arvore->dado) arvore->direita = arvoreRemove(arvore->direita, dado); // Senão, remove pela direita
+  if (dado < arvore->dado) arvore->esquerda = removeNo(arvore->esquerda, dado); // Se o elemento é menor, remove pela esquerda
+  else if (dado > arvore->dado) arvore->direita = removeNo(arvore->direita, dado); // Senão, remove pela direita
   else { // Encontrou o nó a ser removido
     if (arvore->esquerda == NULL) { // Se não tem filho esquerdo, conecta o nó direito ao pai do nó a ser removido
       Arvore temp = arvore->direita;
-      free(arvore);
+      noLibera(arvore);
       return temp;
     } else if (arvore->direita == NULL) { // Senão, se não tem filho direito, conecta o nó esquerdo ao pai do nó a ser removido
       Arvore temp = arvore->esquerda;
-      free(arvore);
+      noLibera(arvore);
       return temp;
     } else { // Senão, se tem ambos os filhos, remove o nó sucessor em-ordem da direita
       Arvore temp = encontraMinimo(arvore->direita);
       arvore->dado = temp->dado;
-      arvore->direita = arvoreRemove(arvore->direita, temp->dado);
+      arvore->direita = removeNo(arvore->direita, temp->dado);
     }
   }
   return arvore;
 }
 
+// Remove um elemento da árvore
+Arvore arvoreRemove(Arvore arvore, const int dado) {
+  return removeNo(arvore, dado);
+}
+
+// Remove um elemento da árvore, devolvendo o nó à arena (cada nó já conhece a sua arena)
+Arvore arvoreRemoveArena(ArvoreArena *arena, Arvore arvore, const int dado) {
+  (void)arena;
+  return removeNo(arvore, dado);
+}
+
+// Calcula nós, folhas, galhos, altura, menor e maior valor em um único percurso
+int arvoreEstatisticas(Arvore arvore, ArvoreEstatisticas *estatisticas) {
+  *estatisticas = (ArvoreEstatisticas){0, 0, 0, -1, -1, -1};
+  if (arvore == NULL) return 0; // Verifica se a árvore é vazia
+  PilhaNos pilha;
+  pilhaNosCria(&pilha);
+  estatisticas->menor = estatisticas->maior = arvore->dado;
+  if (!pilhaNosEmpilha(&pilha, arvore, 0)) return -1;
+  while (pilha.tam > 0) { // Percorre a árvore em pré-ordem usando a pilha
+    ItemPilha item = pilha.itens[--pilha.tam];
+    Arvore no = item.no;
+    estatisticas->nos++;
+    if (no->esquerda == NULL && no->direita == NULL) estatisticas->folhas++; // Nó sem filhos é folha
+    else estatisticas->galhos++; // Senão é galho
+    if (item.nivel > estatisticas->altura) estatisticas->altura = item.nivel;
+    if (no->dado < estatisticas->menor) estatisticas->menor = no->dado;
+    if (no->dado > estatisticas->maior) estatisticas->maior = no->dado;
+    // Empilha a direita antes da esquerda; a pilha nunca passa de altura + 1 itens
+    if ((no->direita != NULL && !pilhaNosEmpilha(&pilha, no->direita, item.nivel + 1)) ||
+        (no->esquerda != NULL && !pilhaNosEmpilha(&pilha, no->esquerda, item.nivel + 1))) {
+      pilhaNosLibera(&pilha);
+      return -1;
+    }
+  }
+  pilhaNosLibera(&pilha);
+  return 1;
+}
+
 // Conta a quantidade total de nós da árvore
 int arvoreContaNos(Arvore arvore) {
-  if (arvore == NULL) return 0; // Verifica se a árvore é vazia
-  return 1 + arvoreContaNos(arvore->esquerda) + arvoreContaNos(arvore->direita); // Conta os nós da esquerda e da direita
+  ArvoreEstatisticas estatisticas;
+  if (arvoreEstatisticas(arvore, &estatisticas) < 0) return -1; // Falha ao alocar a pilha
+  return estatisticas.nos;
 }
 
 // Conta a quantidade de 'galhos' da árvore
 int arvoreContaGalhos(Arvore arvore) {
-  if (arvore == NULL || (arvore->esquerda == NULL && arvore->direita == NULL)) return 0; // Se a árvore é vazia ou o nó não tem filhos, retorna 0
-  return 1 + arvoreContaGalhos(arvore->esquerda) + arvoreContaGalhos(arvore->direita); // Conta os galhos da esquerda e da direita
+  ArvoreEstatisticas estatisticas;
+  if (arvoreEstatisticas(arvore, &estatisticas) < 0) return -1; // Falha ao alocar a pilha
+  return estatisticas.galhos;
 }
 
 // Conta a quantidade de 'folhas' da árvore
 int arvoreContaFolhas(Arvore arvore) {
-  if (arvore == NULL) return 0; // Se a árvore é vazia, retorna 0
-  if (arvore->esquerda == NULL && arvore->direita == NULL) return 1; // Senão, se o nó não tem filhos, retorna 1
-  return arvoreContaFolhas(arvore->esquerda) + arvoreContaFolhas(arvore->direita); // Conta as folhas da esquerda e da direita
+  ArvoreEstatisticas estatisticas;
+  if (arvoreEstatisticas(arvore, &estatisticas) < 0) return -1; // Falha ao alocar a pilha
+  return estatisticas.folhas;
 }
 
 // Encontra a altura da árvore
 int arvoreAltura(Arvore arvore) {
-  if (arvore == NULL) return -1; // Se a árvore é vazia, retorna -1 
-  int alturaEsquerda = arvoreAltura(arvore->esquerda); // Encontra a altura do lado esquerdo
-  int alturaDireita = arvoreAltura(arvore->direita); // Encontra a altura do lado direito
-  return 1 + (alturaEsquerda > alturaDireita ? alturaEsquerda : alturaDireita); // Retorna a maior altura
+  ArvoreEstatisticas estatisticas;
+  if (arvoreEstatisticas(arvore, &estatisticas) < 0) return -1; // Falha ao alocar a pilha
+  return estatisticas.altura; // -1 se a árvore for vazia
 }
 
 // Encontra o menor valor da árvore
@@ -136,40 +387,216 @@ int arvoreMaior(Arvore arvore) {
 // Espelha a árvore
 int arvoreEspelho(Arvore arvore) {
   if (arvore == NULL) return 0; // Verifica se o nó é vazio
+  PilhaNos pilha;
+  pilhaNosCria(&pilha);
+  if (!pilhaNosEmpilha(&pilha, arvore, 0)) return -1;
+  while (pilha.tam > 0) { // Troca os filhos de cada nó da pilha
+    Arvore no = pilha.itens[--pilha.tam].no;
 
-  // Troca o nó da esquerda com o da direita
-  Arvore temp = arvore->esquerda;
-  arvore->esquerda = arvore->direita;
-  arvore->direita = temp;
+    // Troca o nó da esquerda com o da direita
+    Arvore temp = no->esquerda;
+    no->esquerda = no->direita;
+    no->direita = temp;
 
-  arvoreEspelho(arvore->esquerda); // Espelha o lado esquerdo
-  arvoreEspelho(arvore->direita); // Espelha o lado direito
+    if ((no->esquerda != NULL && !pilhaNosEmpilha(&pilha, no->esquerda, 0)) ||
+        (no->direita != NULL && !pilhaNosEmpilha(&pilha, no->direita, 0))) {
+      pilhaNosLibera(&pilha);
+      return -1;
+    }
+  }
+  pilhaNosLibera(&pilha);
   return 1;
 }
 
-// Exibe a árvore em pré-ordem
+// Exibe a árvore em pré-ordem (percurso de Morris, sem pilha)
 int arvoreExibePreOrdem(Arvore arvore) {
   if (arvore == NULL) return 0; // Verifica se a árvore é vazia
-  printf("%d ", arvore->dado);         
-  arvoreExibePreOrdem(arvore->esquerda); // Exibe o lado esquerdo
-  arvoreExibePreOrdem(arvore->direita); // Exibe o lado direito  
+  Arvore atual = arvore;
+  while (atual != NULL) {
+    if (atual->esquerda == NULL) { // Sem lado esquerdo, exibe e segue pela direita
+      printf("%d ", atual->dado);
+      atual = atual->direita;
+      continue;
+    }
+    Arvore pred = atual->esquerda;
+    while (pred->direita != NULL && pred->direita != atual) pred = pred->direita; // Predecessor em-ordem
+    if (pred->direita == NULL) { // Primeira visita: exibe e cria o atalho de volta
+      printf("%d ", atual->dado);
+      pred->direita = atual;
+      atual = atual->esquerda;
+    } else { // Segunda visita: desfaz o atalho e segue pela direita
+      pred->direita = NULL;
+      atual = atual->direita;
+    }
+  }
   return 1;
 }
 
-// Exibe a árvore em ordem
+// Exibe a árvore em ordem (percurso de Morris, sem pilha)
 int arvoreExibeEmOrdem(Arvore arvore) {
   if (arvore == NULL) return 0; // Verifica se a árvore é vazia
-  arvoreExibeEmOrdem(arvore->esquerda); // Exibe o lado esquerdo   
-  printf("%d ", arvore->dado);        
-  arvoreExibeEmOrdem(arvore->direita); // Exibe o lado direito  
-  return 1; 
+  Arvore atual = arvore;
+  while (atual != NULL) {
+    if (atual->esquerda == NULL) { // Sem lado esquerdo, exibe e segue pela direita
+      printf("%d ", atual->dado);
+      atual = atual->direita;
+      continue;
+    }
+    Arvore pred = atual->esquerda;
+    while (pred->direita != NULL && pred->direita != atual) pred = pred->direita; // Predecessor em-ordem
+    if (pred->direita == NULL) { // Primeira visita: cria o atalho de volta
+      pred->direita = atual;
+      atual = atual->esquerda;
+    } else { // Segunda visita: desfaz o atalho, exibe e segue pela direita
+      pred->direita = NULL;
+      printf("%d ", atual->dado);
+      atual = atual->direita;
+    }
+  }
+  return 1;
 }
 
 // Exibe a árvore em pós-ordem
 int arvoreExibePosOrdem(Arvore arvore) {
   if (arvore == NULL) return 0; // Verifica se a árvore é vazia
-  arvoreExibePosOrdem(arvore->esquerda); // Exibe o lado esquerdo     
-  arvoreExibePosOrdem(arvore->direita); // Exibe o lado direito
-  printf("%d ", arvore->dado); 
-  return 1;     
-}
\ No newline at end of file
+  PilhaNos pilha;
+  pilhaNosCria(&pilha);
+  Arvore atual = arvore, ultimo = NULL;
+  while (atual != NULL || pilha.tam > 0) {
+    if (atual != NULL) { // Desce pela esquerda empilhando o caminho
+      if (!pilhaNosEmpilha(&pilha, atual, 0)) {
+        pilhaNosLibera(&pilha);
+        return -1;
+      }
+      atual = atual->esquerda;
+      continue;
+    }
+    Arvore topo = pilha.itens[pilha.tam - 1].no;
+    if (topo->direita != NULL && topo->direita != ultimo) atual = topo->direita; // Lado direito ainda não exibido
+    else { // Ambos os lados já exibidos
+      printf("%d ", topo->dado);
+      ultimo = topo;
+      pilha.tam--;
+    }
+  }
+  pilhaNosLibera(&pilha);
+  return 1;
+}
+
+// Salva a árvore em um arquivo binário (pré-ordem com os índices dos filhos)
+int arvoreSalva(Arvore arvore, const char *nome_arqv) {
+  ArvoreEstatisticas estatisticas;
+  if (arvoreEstatisticas(arvore, &estatisticas) < 0) return -1;
+  size_t qtd = (size_t)estatisticas.nos;
+  NoImagem *nos = (NoImagem *)malloc((qtd > 0 ? qtd : 1) * sizeof(NoImagem));
+  if (nos == NULL) return -1;
+  PilhaNos pilha;
+  pilhaNosCria(&pilha);
+  int32_t i = 0;
+  if (arvore != NULL && !pilhaNosEmpilha(&pilha, arvore, -1)) {
+    free(nos);
+    return -1;
+  }
+  while (pilha.tam > 0) { // Numera os nós em pré-ordem e liga cada um ao pai ('nivel' guarda 2 * pai + lado)
+    ItemPilha item = pilha.itens[--pilha.tam];
+    nos[i] = (NoImagem){item.no->dado, -1, -1};
+    if (item.nivel >= 0) {
+      if (item.nivel % 2 == 0) nos[item.nivel / 2].esquerda = i;
+      else nos[item.nivel / 2].direita = i;
+    }
+    if ((item.no->direita != NULL && !pilhaNosEmpilha(&pilha, item.no->direita, 2 * i + 1)) ||
+        (item.no->esquerda != NULL && !pilhaNosEmpilha(&pilha, item.no->esquerda, 2 * i))) {
+      pilhaNosLibera(&pilha);
+      free(nos);
+      return -1;
+    }
+    i++;
+  }
+  pilhaNosLibera(&pilha);
+  int ok = arvoreImagemGrava(nome_arqv, nos, qtd);
+  free(nos);
+  return ok;
+}
+
+
+// Verifica se cada nó da imagem tem no máximo um pai e se todos, exceto a raiz, têm pai
+static int imagemValida(const ArvoreImagem *imagem) {
+  size_t qtd = arvoreImagemTamanho(imagem), ligacoes = 0;
+  const NoImagem *nosImagem = arvoreImagemNos(imagem);
+  unsigned char *temPai = (unsigned char *)calloc(qtd / 8 + 1, 1);
+  if (temPai == NULL) return 0;
+  int valida = 1;
+  for (size_t i = 0; i < qtd && valida; i++) {
+    int32_t filhos[2] = {nosImagem[i].esquerda, nosImagem[i].direita};
+    for (int j = 0; j < 2 && valida; j++) {
+      int32_t f = filhos[j];
+      if (f < 0) continue;
+      if ((size_t)f <= i || (size_t)f >= qtd || (temPai[f / 8] & (1 << (f % 8)))) valida = 0; // Filhos sempre depois do pai e com um único pai
+      else {
+        temPai[f / 8] |= (unsigned char)(1 << (f % 8));
+        ligacoes++;
+      }
+    }
+  }
+  free(temPai);
+  return valida && ligacoes == qtd - 1;
+}
+
+// Reconstrói a árvore a partir da imagem, usando 'nos' (se houver) como bloco contíguo
+static Arvore carregaImagem(const ArvoreImagem *imagem, ArvoreArena *arena, struct No *nos) {
+  size_t qtd = arvoreImagemTamanho(imagem);
+  const NoImagem *nosImagem = arvoreImagemNos(imagem);
+  if (qtd == 0 || !imagemValida(imagem)) return NULL;
+  Arvore *ponteiros = NULL;
+  if (nos == NULL) { // Sem arena: um nó por alocação, guardados em uma tabela temporária
+    ponteiros = (Arvore *)malloc(qtd * sizeof(Arvore));
+    if (ponteiros == NULL) return NULL;
+    for (size_t i = 0; i < qtd; i++) {
+      ponteiros[i] = noCria(NULL, 0);
+      if (ponteiros[i] == NULL) {
+        while (i > 0) free(ponteiros[--i]);
+        free(ponteiros);
+        return NULL;
+      }
+    }
+  }
+  for (size_t i = 0; i < qtd; i++) { // Liga os nós seguindo os índices da imagem
+    Arvore no = (nos != NULL) ? &nos[i] : ponteiros[i];
+    int32_t e = nosImagem[i].esquerda, d = nosImagem[i].direita;
+    no->dado = nosImagem[i].dado;
+    no->arena = arena;
+    no->esquerda = (e < 0) ? NULL : (nos != NULL) ? &nos[e] : ponteiros[e];
+    no->direita = (d < 0) ? NULL : (nos != NULL) ? &nos[d] : ponteiros[d];
+  }
+  Arvore arvore = (nos != NULL) ? &nos[0] : ponteiros[0];
+  free(ponteiros);
+  return arvore;
+}
+
+// Carrega uma árvore salva por 'arvoreSalva'
+Arvore arvoreCarrega(const char *nome_arqv) {
+  ArvoreImagem *imagem = arvoreImagemAbre(nome_arqv);
+  if (imagem == NULL) return NULL;
+  Arvore arvore = carregaImagem(imagem, NULL, NULL);
+  arvoreImagemFecha(imagem);
+  return arvore;
+}
+
+// Carrega uma árvore salva por 'arvoreSalva' com todos os nós em uma única alocação da arena
+Arvore arvoreCarregaArena(ArvoreArena *arena, const char *nome_arqv) {
+  ArvoreImagem *imagem = arvoreImagemAbre(nome_arqv);
+  if (imagem == NULL) return NULL;
+  Arvore arvore = NULL;
+  size_t qtd = arvoreImagemTamanho(imagem);
+  Bloco *bloco = (qtd > 0) ? arenaReserva(arena, qtd) : NULL;
+  if (bloco != NULL) {
+    arvore = carregaImagem(imagem, arena, &bloco->nos[bloco->usados]);
+    if (arvore != NULL) { // Só consome o bloco se a imagem for válida
+      bloco->usados += qtd;
+      arena->estatisticas.nosAlocados += qtd;
+      arena->estatisticas.nosEmUso += qtd;
+    }
+  }
+  arvoreImagemFecha(imagem);
+  return arvore;
+}
@@ -1,13 +1,41 @@
 #ifndef ARVORE_H
 #define ARVORE_H
 
+#include <stddef.h>
+#include "../ArvoreImagem/arvore_imagem.h" // Imagem binária mapeada em memória (arvoreImagemAbre/Busca/Fecha)
+
+// Quantidade padrão de nós por bloco da arena
+#define ARVORE_ARENA_BLOCO_PADRAO 4096
+
 // Estrutura abstrata da Árvore Binária de Pesquisa (ABP)
 typedef struct No *Arvore;
 
+// Estrutura abstrata da arena de nós (alocação em blocos contíguos)
+typedef struct ArvoreArena ArvoreArena;
+
+// Estatísticas de alocação da arena
+typedef struct {
+  size_t blocos;      // Blocos alocados
+  size_t nosAlocados; // Nós já entregues pelos blocos
+  size_t nosEmUso;    // Nós atualmente em alguma árvore
+  size_t nosLivres;   // Nós removidos aguardando reaproveitamento
+  size_t bytes;       // Memória total reservada pelos blocos
+} ArvoreArenaEstatisticas;
+
+// Estatísticas da árvore calculadas em um único percurso
+typedef struct {
+  int nos;    // Quantidade total de nós
+  int folhas; // Nós sem filhos
+  int galhos; // Nós com pelo menos um filho
+  int altura; // Altura da árvore (-1 se vazia)
+  int menor;  // Menor valor (-1 se vazia)
+  int maior;  // Maior valor (-1 se vazia)
+} ArvoreEstatisticas;
+
 // Cria uma nova árvore vazia
 Arvore arvoreCria();
 
-// Libera a memória alocada para uma árvore
+// Libera a memória alocada para uma árvore (nós de arena voltam p/ a sua arena)
 Arvore arvoreLibera(Arvore arvore);
 
 // Encontra e retorna o nó de menor valor da árvore
@@ -16,12 +44,36 @@ Arvore arvoreVazia(Arvore arvore);
 // Remove um elemento da árvore
 Arvore arvoreInsere(Arvore arvore, int data);
 
+// Cria uma arena que entrega nós em blocos contíguos de 'nosPorBloco' nós (0 usa o padrão)
+ArvoreArena *arvoreArenaCria(size_t nosPorBloco);
+
+// Libera a arena e todos os seus nós em O(blocos); as árvores da arena deixam de ser válidas
+ArvoreArena *arvoreArenaLibera(ArvoreArena *arena);
+
+// Retorna as estatísticas de alocação da arena
+ArvoreArenaEstatisticas arvoreArenaEstatisticas(const ArvoreArena *arena);
+
+// Insere um elemento na árvore usando um nó da arena
+Arvore arvoreInsereArena(ArvoreArena *arena, Arvore arvore, int data);
+
+// Remove um elemento da árvore, devolvendo o nó à arena
+Arvore arvoreRemoveArena(ArvoreArena *arena, Arvore arvore, int data);
+
+// Constrói uma árvore perfeitamente balanceada a partir de um vetor (ordena uma cópia se necessário)
+Arvore arvoreConstroi(const int *v, size_t n);
+
+// Constrói uma árvore perfeitamente balanceada a partir de um vetor, com todos os nós em uma única alocação da arena
+Arvore arvoreConstroiArena(ArvoreArena *arena, const int *v, size_t n);
+
 // Busca um elemento na árvore
 Arvore arvoreBusca(Arvore arvore, const int dado);
 
 // Conta a quantidade total de nós da árvore
 Arvore arvoreRemove(Arvore arvore, int data);
 
+// Calcula nós, folhas, galhos, altura, menor e maior valor em um único percurso (1: ok, 0: vazia, -1: sem memória)
+int arvoreEstatisticas(Arvore arvore, ArvoreEstatisticas *estatisticas);
+
 // Conta a quantidade total de nós da árvore
 int arvoreContaNos(Arvore arvore);
 
@@ -52,4 +104,13 @@ int arvoreExibeEmOrdem(Arvore arvore);
 // Exibe a árvore em pós-ordem
 int arvoreExibePosOrdem(Arvore arvore);
 
+// Salva a árvore em um arquivo binário (pré-ordem com os índices dos filhos)
+int arvoreSalva(Arvore arvore, const char *nome_arqv);
+
+// Carrega uma árvore salva por 'arvoreSalva'
+Arvore arvoreCarrega(const char *nome_arqv);
+
+// Carrega uma árvore salva por 'arvoreSalva' com todos os nós em uma única alocação da arena
+Arvore arvoreCarregaArena(ArvoreArena *arena, const char *nome_arqv);
+
 #endif
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "arvore.h"
 #include "cores.h"
 
+// Compilar: gcc testeArvore.c arvore.c ../ArvoreImagem/arvore_imagem.c -o testeArvore
+
 void limpaBuffer() {
   char c;
   while((c = getchar()) != '\n' && c != EOF);
@@ -60,11 +62,14 @@ int main() {
   arvoreExibeEmOrdem(arvore);
 
   printf(f(BOLD UNDERLINE MAGENTA, "\n\nDados da árvore\n"));
-  printf(f(BOLD GREEN, "Altura da árvore: %d"), arvoreAltura(arvore));
-  printf(f(BOLD GREEN, "\nQuantidade total de nós da árvore: %d"), arvoreContaNos(arvore));
-  printf(f(BOLD GREEN, "\nQuantidade de nós folhas da árvore: %d"), arvoreContaFolhas(arvore));
-  printf(f(BOLD GREEN, "\nQuantidade de galhos da árvore: %d"), arvoreContaGalhos(arvore));
-  printf(f(BOLD GREEN, "\nMaior nó da árvore: %d"), arvoreMaior(arvore));
+  ArvoreEstatisticas dados;
+  timer(arvoreEstatisticas(arvore, &dados););
+  printf(f(BOLD GREEN, "Altura da árvore: %d"), dados.altura);
+  printf(f(BOLD GREEN, "\nQuantidade total de nós da árvore: %d"), dados.nos);
+  printf(f(BOLD GREEN, "\nQuantidade de nós folhas da árvore: %d"), dados.folhas);
+  printf(f(BOLD GREEN, "\nQuantidade de galhos da árvore: %d"), dados.galhos);
+  printf(f(BOLD GREEN, "\nMenor nó da árvore: %d"), dados.menor);
+  printf(f(BOLD GREEN, "\nMaior nó da árvore: %d"), dados.maior);
 
   printf(f(BOLD UNDERLINE MAGENTA, "\n\nÁrvore espelhada\n"));
   timer(arvoreEspelho(arvore););
@@ -75,6 +80,15 @@ int main() {
   timer(arvore = arvoreLibera(arvore););
   printf(f(BOLD GREEN, "Árvore liberada com sucesso!\n"));
 
+  printf(f(BOLD UNDERLINE MAGENTA, "\nInserção de elementos usando arena\n"));
+  ArvoreArena *arena = arvoreArenaCria(0);
+  timer(for(int i = 0; i < qtd; i++) arvore = arvoreInsereArena(arena, arvore, rand() % 100););
+  ArvoreArenaEstatisticas estatisticas = arvoreArenaEstatisticas(arena);
+  printf(f(BOLD GREEN, "Blocos: %zu | Nós em uso: %zu | Bytes: %zu\n"), estatisticas.blocos, estatisticas.nosEmUso, estatisticas.bytes);
+  timer(arena = arvoreArenaLibera(arena););
+  arvore = arvoreCria();
+  printf(f(BOLD GREEN, "Arena liberada com sucesso!\n"));
+
   printf(f(BOLD UNDERLINE CYAN, "\nFIM DO PROGRAMA!\n"));
   return 0;
 }
\ No newline at end of file
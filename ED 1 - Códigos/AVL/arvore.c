@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include "arvore.h"
 
 typedef struct No {
@@ -7,6 +8,7 @@ typedef struct No {
   struct No *direita;
   struct No *esquerda;
   int altura;
+  int tamanho;
 } *Arvore;
 
 int max(int a, int b) {
@@ -17,6 +19,15 @@ int altura(Arvore no) {
   return (no == NULL) ? -1 : no->altura;
 }
 
+static int tamanho(Arvore no) {
+  return (no == NULL) ? 0 : no->tamanho;
+}
+
+static void atualiza(Arvore no) {
+  no->altura = max(altura(no->esquerda), altura(no->direita)) + 1;
+  no->tamanho = tamanho(no->esquerda) + tamanho(no->direita) + 1;
+}
+
 int fatorBalanceamento(Arvore no) {
   return (no == NULL) ? 0 : altura(no->esquerda) - altura(no->direita);
 }
@@ -26,8 +37,8 @@ Arvore rotacaoDireita(Arvore y) {
   Arvore T2 = x->direita;
   x->direita = y;
   y->esquerda = T2;
-  y->altura = max(altura(y->esquerda), altura(y->direita)) + 1;
-  x->altura = max(altura(x->esquerda), altura(x->direita)) + 1;
+  atualiza(y);
+  atualiza(x);
   return x;
 }
 
@@ -36,8 +47,8 @@ Arvore rotacaoEsquerda(Arvore x) {
   Arvore T2 = y->esquerda;
   y->esquerda = x;
   x->direita = T2;
-  x->altura = max(altura(x->esquerda), altura(x->direita)) + 1;
-  y->altura = max(altura(y->esquerda), altura(y->direita)) + 1;
+  atualiza(x);
+  atualiza(y);
   return y;
 }
 
@@ -61,20 +72,80 @@ Arvore arvoreCria() {
 }
 
 Arvore arvoreInsere(Arvore arvore, const int dado) {
-  if (arvore == NULL) {
-    Arvore no = (Arvore)malloc(sizeof(struct No));
-    if (no == NULL) return NULL;
-    no->dado = dado;
-    no->esquerda = NULL;
-    no->direita = NULL;
-    no->altura = 0;
-    return no;
+  Arvore *caminho[ARVORE_ALTURA_MAX];
+  int topo = 0;
+  Arvore *ligacao = &arvore;
+  while (*ligacao != NULL) {
+    if (dado == (*ligacao)->dado) return arvore;
+    caminho[topo++] = ligacao;
+    ligacao = (dado < (*ligacao)->dado) ? &(*ligacao)->esquerda : &(*ligacao)->direita;
+  }
+  Arvore no = (Arvore)malloc(sizeof(struct No));
+  if (no == NULL) return arvore;
+  no->dado = dado;
+  no->esquerda = NULL;
+  no->direita = NULL;
+  no->altura = 0;
+  no->tamanho = 1;
+  *ligacao = no;
+  while (topo > 0) {
+    ligacao = caminho[--topo];
+    int alturaAntes = (*ligacao)->altura;
+    atualiza(*ligacao);
+    *ligacao = balancearNo(*ligacao);
+    if ((*ligacao)->altura == alturaAntes) break;
   }
-  if (dado < arvore->dado) arvore->esquerda = arvoreInsere(arvore->esquerda, dado);
-  else if (dado > arvore->dado) arvore->direita = arvoreInsere(arvore->direita, dado);
-  else return arvore;
-  arvore->altura = 1 + max(altura(arvore->esquerda), altura(arvore->direita));
-  return balancearNo(arvore);
+  while (topo > 0) (*caminho[--topo])->tamanho++;
+  return arvore;
+}
+
+static int comparaInt(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+static Arvore constroiNo(const int *v, size_t n) {
+  if (n == 0) return NULL;
+  size_t meio = n / 2;
+  Arvore no = (Arvore)malloc(sizeof(struct No));
+  if (no == NULL) return NULL;
+  no->dado = v[meio];
+  no->esquerda = constroiNo(v, meio);
+  no->direita = constroiNo(v + meio + 1, n - meio - 1);
+  if ((meio > 0 && no->esquerda == NULL) || (n - meio - 1 > 0 && no->direita == NULL)) {
+    arvoreLibera(no);
+    return NULL;
+  }
+  atualiza(no);
+  return no;
+}
+
+Arvore arvoreConstroi(const int *v, size_t n) {
+  if (v == NULL || n == 0) return NULL;
+  int *copia = NULL;
+  size_t i = 1;
+  while (i < n && v[i - 1] < v[i]) i++;
+  if (i < n) {
+    copia = (int *)malloc(n * sizeof(int));
+    if (copia == NULL) return NULL;
+    for (i = 0; i < n; i++) copia[i] = v[i];
+    qsort(copia, n, sizeof(int), comparaInt);
+    size_t unicos = 1;
+    for (i = 1; i < n; i++) if (copia[i] != copia[unicos - 1]) copia[unicos++] = copia[i];
+    v = copia;
+    n = unicos;
+  }
+  Arvore arvore = constroiNo(v, n);
+  free(copia);
+  return arvore;
+}
+
+int arvoreBusca(Arvore arvore, const int dado) {
+  while (arvore != NULL) {
+    if (dado == arvore->dado) return 1;
+    arvore = (dado < arvore->dado) ? arvore->esquerda : arvore->direita;
+  }
+  return 0;
 }
 
 Arvore encontraMinimo(Arvore arvore) {
@@ -83,26 +154,323 @@ Arvore encontraMinimo(Arvore arvore) {
 }
 
 Arvore arvoreRemove(Arvore arvore, const int dado) {
-  if (arvore == NULL) return NULL;
-  if (dado < arvore->dado) arvore->esquerda = arvoreRemove(arvore->esquerda, dado);
-  else if (dado > arvore->dado) arvore->direita = arvoreRemove(arvore->direita, dado);
-  else {
-    if (arvore->esquerda == NULL) {
-      Arvore temp = arvore->direita;
-      free(arvore);
-      return temp;
-    } else if (arvore->direita == NULL) {
-      Arvore temp = arvore->esquerda;
-      free(arvore);
-      return temp;
-    } else {
-      Arvore temp = encontraMinimo(arvore->direita);
-      arvore->dado = temp->dado;
-      arvore->direita = arvoreRemove(arvore->direita, temp->dado);
+  Arvore *caminho[ARVORE_ALTURA_MAX];
+  int topo = 0;
+  Arvore *ligacao = &arvore;
+  while (*ligacao != NULL && (*ligacao)->dado != dado) {
+    caminho[topo++] = ligacao;
+    ligacao = (dado < (*ligacao)->dado) ? &(*ligacao)->esquerda : &(*ligacao)->direita;
+  }
+  if (*ligacao == NULL) return arvore;
+  Arvore alvo = *ligacao;
+  if (alvo->esquerda != NULL && alvo->direita != NULL) {
+    caminho[topo++] = ligacao;
+    ligacao = &alvo->direita;
+    while ((*ligacao)->esquerda != NULL) {
+      caminho[topo++] = ligacao;
+      ligacao = &(*ligacao)->esquerda;
     }
+    Arvore sucessor = *ligacao;
+    alvo->dado = sucessor->dado;
+    *ligacao = sucessor->direita;
+    free(sucessor);
+  } else {
+    *ligacao = (alvo->esquerda != NULL) ? alvo->esquerda : alvo->direita;
+    free(alvo);
   }
-  arvore->altura = 1 + max(altura(arvore->esquerda), altura(arvore->direita));
-  return balancearNo(arvore);
+  while (topo > 0) {
+    ligacao = caminho[--topo];
+    int alturaAntes = (*ligacao)->altura;
+    atualiza(*ligacao);
+    *ligacao = balancearNo(*ligacao);
+    if ((*ligacao)->altura == alturaAntes) break;
+  }
+  while (topo > 0) (*caminho[--topo])->tamanho--;
+  return arvore;
+}
+
+int arvoreTamanho(Arvore arvore) {
+  return tamanho(arvore);
+}
+
+int arvoreContaMenores(Arvore arvore, const int dado) {
+  int cont = 0;
+  while (arvore != NULL) {
+    if (dado <= arvore->dado) arvore = arvore->esquerda;
+    else {
+      cont += tamanho(arvore->esquerda) + 1;
+      arvore = arvore->direita;
+    }
+  }
+  return cont;
+}
+
+int arvoreKesimo(Arvore arvore, int k, int *dado) {
+  if (k < 1 || k > tamanho(arvore)) return 0;
+  while (arvore != NULL) {
+    int esquerda = tamanho(arvore->esquerda);
+    if (k == esquerda + 1) {
+      *dado = arvore->dado;
+      return 1;
+    }
+    if (k <= esquerda) arvore = arvore->esquerda;
+    else {
+      k -= esquerda + 1;
+      arvore = arvore->direita;
+    }
+  }
+  return 0;
+}
+
+static void cursorDesce(ArvoreCursor *cursor, Arvore no) {
+  while (no != NULL) {
+    cursor->pilha[cursor->topo++] = no;
+    no = no->esquerda;
+  }
+}
+
+void arvoreCursorInicio(ArvoreCursor *cursor, Arvore arvore) {
+  cursor->topo = 0;
+  cursorDesce(cursor, arvore);
+}
+
+void arvoreCursorBusca(ArvoreCursor *cursor, Arvore arvore, const int dado) {
+  cursor->topo = 0;
+  while (arvore != NULL) {
+    if (dado <= arvore->dado) {
+      cursor->pilha[cursor->topo++] = arvore;
+      if (dado == arvore->dado) return;
+      arvore = arvore->esquerda;
+    } else arvore = arvore->direita;
+  }
+}
+
+int arvoreCursorValido(const ArvoreCursor *cursor) {
+  return cursor->topo > 0;
+}
+
+int arvoreCursorDado(const ArvoreCursor *cursor) {
+  return cursor->pilha[cursor->topo - 1]->dado;
+}
+
+int arvoreCursorProximo(ArvoreCursor *cursor) {
+  if (cursor->topo == 0) return 0;
+  Arvore no = cursor->pilha[--cursor->topo];
+  cursorDesce(cursor, no->direita);
+  return cursor->topo > 0;
+}
+
+int arvoreIntervalo(Arvore arvore, const int menor, const int maior, void (*visita)(int dado, void *contexto), void *contexto) {
+  ArvoreCursor cursor;
+  int cont = 0;
+  for (arvoreCursorBusca(&cursor, arvore, menor); arvoreCursorValido(&cursor); arvoreCursorProximo(&cursor)) {
+    int dado = arvoreCursorDado(&cursor);
+    if (dado > maior) break;
+    visita(dado, contexto);
+    cont++;
+  }
+  return cont;
+}
+
+static Arvore juntaDireita(Arvore menores, Arvore no, Arvore maiores) {
+  Arvore c = menores->direita;
+  if (altura(c) <= altura(maiores) + 1) {
+    no->esquerda = c;
+    no->direita = maiores;
+    atualiza(no);
+    if (altura(no) <= altura(menores->esquerda) + 1) {
+      menores->direita = no;
+      atualiza(menores);
+      return menores;
+    }
+    menores->direita = rotacaoDireita(no);
+    atualiza(menores);
+    return rotacaoEsquerda(menores);
+  }
+  menores->direita = juntaDireita(c, no, maiores);
+  atualiza(menores);
+  if (altura(menores->direita) <= altura(menores->esquerda) + 1) return menores;
+  return rotacaoEsquerda(menores);
+}
+
+static Arvore juntaEsquerda(Arvore menores, Arvore no, Arvore maiores) {
+  Arvore c = maiores->esquerda;
+  if (altura(c) <= altura(menores) + 1) {
+    no->esquerda = menores;
+    no->direita = c;
+    atualiza(no);
+    if (altura(no) <= altura(maiores->direita) + 1) {
+      maiores->esquerda = no;
+      atualiza(maiores);
+      return maiores;
+    }
+    maiores->esquerda = rotacaoEsquerda(no);
+    atualiza(maiores);
+    return rotacaoDireita(maiores);
+  }
+  maiores->esquerda = juntaEsquerda(menores, no, c);
+  atualiza(maiores);
+  if (altura(maiores->esquerda) <= altura(maiores->direita) + 1) return maiores;
+  return rotacaoDireita(maiores);
+}
+
+static Arvore junta(Arvore menores, Arvore no, Arvore maiores) {
+  if (altura(menores) > altura(maiores) + 1) return juntaDireita(menores, no, maiores);
+  if (altura(maiores) > altura(menores) + 1) return juntaEsquerda(menores, no, maiores);
+  no->esquerda = menores;
+  no->direita = maiores;
+  atualiza(no);
+  return no;
+}
+
+static Arvore separaMaior(Arvore arvore, Arvore *maior) {
+  Arvore esquerda = arvore->esquerda, direita = arvore->direita;
+  if (direita == NULL) {
+    arvore->esquerda = NULL;
+    *maior = arvore;
+    return esquerda;
+  }
+  direita = separaMaior(direita, maior);
+  return junta(esquerda, arvore, direita);
+}
+
+static Arvore concatena(Arvore menores, Arvore maiores) {
+  if (menores == NULL) return maiores;
+  if (maiores == NULL) return menores;
+  Arvore maior;
+  menores = separaMaior(menores, &maior);
+  return junta(menores, maior, maiores);
+}
+
+static Arvore divide(Arvore arvore, const int dado, Arvore *menores, Arvore *maiores) {
+  if (arvore == NULL) {
+    *menores = *maiores = NULL;
+    return NULL;
+  }
+  Arvore esquerda = arvore->esquerda, direita = arvore->direita, encontrado;
+  if (dado == arvore->dado) {
+    *menores = esquerda;
+    *maiores = direita;
+    arvore->esquerda = arvore->direita = NULL;
+    atualiza(arvore);
+    return arvore;
+  }
+  if (dado < arvore->dado) {
+    encontrado = divide(esquerda, dado, menores, &esquerda);
+    *maiores = junta(esquerda, arvore, direita);
+  } else {
+    encontrado = divide(direita, dado, &direita, maiores);
+    *menores = junta(esquerda, arvore, direita);
+  }
+  return encontrado;
+}
+
+Arvore arvoreJoin(Arvore menores, const int dado, Arvore maiores) {
+  Arvore no = (Arvore)malloc(sizeof(struct No));
+  if (no == NULL) return concatena(menores, maiores);
+  no->dado = dado;
+  return junta(menores, no, maiores);
+}
+
+int arvoreSplit(Arvore arvore, const int dado, Arvore *menores, Arvore *maiores) {
+  Arvore encontrado = divide(arvore, dado, menores, maiores);
+  if (encontrado == NULL) return 0;
+  free(encontrado);
+  return 1;
+}
+
+Arvore arvoreUniao(Arvore a, Arvore b) {
+  if (a == NULL) return b;
+  if (b == NULL) return a;
+  Arvore esquerda = b->esquerda, direita = b->direita, menores, maiores;
+  free(divide(a, b->dado, &menores, &maiores));
+  return junta(arvoreUniao(menores, esquerda), b, arvoreUniao(maiores, direita));
+}
+
+Arvore arvoreIntersecao(Arvore a, Arvore b) {
+  if (a == NULL || b == NULL) {
+    arvoreLibera(a);
+    arvoreLibera(b);
+    return NULL;
+  }
+  Arvore esquerda = b->esquerda, direita = b->direita, menores, maiores;
+  Arvore encontrado = divide(a, b->dado, &menores, &maiores);
+  menores = arvoreIntersecao(menores, esquerda);
+  maiores = arvoreIntersecao(maiores, direita);
+  if (encontrado != NULL) {
+    free(encontrado);
+    return junta(menores, b, maiores);
+  }
+  free(b);
+  return concatena(menores, maiores);
+}
+
+Arvore arvoreDiferenca(Arvore a, Arvore b) {
+  if (a == NULL || b == NULL) {
+    arvoreLibera(b);
+    return a;
+  }
+  Arvore esquerda = b->esquerda, direita = b->direita, menores, maiores;
+  free(divide(a, b->dado, &menores, &maiores));
+  free(b);
+  return concatena(arvoreDiferenca(menores, esquerda), arvoreDiferenca(maiores, direita));
+}
+
+static int32_t salvaNo(Arvore no, NoImagem *nos, int32_t *qtd) {
+  if (no == NULL) return -1;
+  int32_t i = (*qtd)++;
+  nos[i].dado = no->dado;
+  nos[i].esquerda = salvaNo(no->esquerda, nos, qtd);
+  nos[i].direita = salvaNo(no->direita, nos, qtd);
+  return i;
+}
+
+int arvoreSalva(Arvore arvore, const char *nome_arqv) {
+  size_t qtd = (size_t)tamanho(arvore);
+  NoImagem *nos = (NoImagem *)malloc((qtd > 0 ? qtd : 1) * sizeof(NoImagem));
+  if (nos == NULL) return -1;
+  int32_t usados = 0;
+  salvaNo(arvore, nos, &usados);
+  int ok = arvoreImagemGrava(nome_arqv, nos, qtd);
+  free(nos);
+  return ok;
+}
+
+Arvore arvoreCarrega(const char *nome_arqv) {
+  ArvoreImagem *mapa = arvoreImagemAbre(nome_arqv);
+  size_t qtd = arvoreImagemTamanho(mapa), i = 0;
+  if (qtd == 0) {
+    arvoreImagemFecha(mapa);
+    return NULL;
+  }
+  const NoImagem *imagem = arvoreImagemNos(mapa);
+  Arvore *ponteiros = (Arvore *)malloc(qtd * sizeof(Arvore));
+  int32_t *minimo = (int32_t *)malloc(qtd * sizeof(int32_t)), *maximo = (int32_t *)malloc(qtd * sizeof(int32_t));
+  int valida = ponteiros != NULL && minimo != NULL && maximo != NULL;
+  while (valida && i < qtd && (ponteiros[i] = (Arvore)malloc(sizeof(struct No))) != NULL) i++;
+  valida = valida && i == qtd;
+  for (size_t j = qtd; valida && j-- > 0;) {
+    int32_t e = imagem[j].esquerda, d = imagem[j].direita, dado = imagem[j].dado;
+    Arvore no = ponteiros[j];
+    no->esquerda = (e >= 0 && (size_t)e == j + 1 && (size_t)e < qtd) ? ponteiros[e] : NULL;
+    no->direita = (d >= 0 && (size_t)d == j + 1 + (size_t)tamanho(no->esquerda) && (size_t)d < qtd) ? ponteiros[d] : NULL;
+    if ((e >= 0 && no->esquerda == NULL) || (d >= 0 && no->direita == NULL)) valida = 0;
+    else if ((e >= 0 && maximo[e] >= dado) || (d >= 0 && minimo[d] <= dado)) valida = 0;
+    if (!valida) break;
+    minimo[j] = (e >= 0) ? minimo[e] : dado;
+    maximo[j] = (d >= 0) ? maximo[d] : dado;
+    no->dado = dado;
+    atualiza(no);
+    if (fatorBalanceamento(no) < -1 || fatorBalanceamento(no) > 1 || no->altura >= ARVORE_ALTURA_MAX) valida = 0;
+  }
+  Arvore arvore = NULL;
+  if (valida && (size_t)ponteiros[0]->tamanho == qtd) arvore = ponteiros[0];
+  else while (ponteiros != NULL && i > 0) free(ponteiros[--i]);
+  free(ponteiros);
+  free(minimo);
+  free(maximo);
+  arvoreImagemFecha(mapa);
+  return arvore;
 }
 
 Arvore arvoreLibera(Arvore arvore) {
@@ -1,8 +1,18 @@
 #ifndef ARVORE_H
 #define ARVORE_H
 
+#include <stddef.h>
+#include "../ArvoreImagem/arvore_imagem.h"
+
+#define ARVORE_ALTURA_MAX 64
+
 typedef struct No *Arvore;
 
+typedef struct {
+  Arvore pilha[ARVORE_ALTURA_MAX];
+  int topo;
+} ArvoreCursor;
+
 Arvore arvoreCria();
 
 Arvore arvoreLibera(Arvore arvore);
@@ -11,12 +21,46 @@ Arvore arvoreVazia(Arvore arvore);
 
 Arvore arvoreInsere(Arvore arvore, int dado);
 
+Arvore arvoreConstroi(const int *v, size_t n);
+
 Arvore encontraMinimo(Arvore arvore);
 
 Arvore arvoreRemove(Arvore arvore, int dado);
 
 int arvoreBusca(Arvore arvore, int dado);
 
+int arvoreTamanho(Arvore arvore);
+
+int arvoreContaMenores(Arvore arvore, int dado);
+
+int arvoreKesimo(Arvore arvore, int k, int *dado);
+
+void arvoreCursorInicio(ArvoreCursor *cursor, Arvore arvore);
+
+void arvoreCursorBusca(ArvoreCursor *cursor, Arvore arvore, int dado);
+
+int arvoreCursorValido(const ArvoreCursor *cursor);
+
+int arvoreCursorDado(const ArvoreCursor *cursor);
+
+int arvoreCursorProximo(ArvoreCursor *cursor);
+
+int arvoreIntervalo(Arvore arvore, int menor, int maior, void (*visita)(int dado, void *contexto), void *contexto);
+
+Arvore arvoreJoin(Arvore menores, int dado, Arvore maiores);
+
+int arvoreSplit(Arvore arvore, int dado, Arvore *menores, Arvore *maiores);
+
+Arvore arvoreUniao(Arvore a, Arvore b);
+
+Arvore arvoreIntersecao(Arvore a, Arvore b);
+
+Arvore arvoreDiferenca(Arvore a, Arvore b);
+
+int arvoreSalva(Arvore arvore, const char *nome_arqv);
+
+Arvore arvoreCarrega(const char *nome_arqv);
+
 int arvoreExibe(Arvore arvore, int nivel);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,319 @@
+#include <stdlib.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "arvore_concorrente.h"
+
+// Máximo de nós copiados em uma única atualização (caminho + rotações de cada nível)
+#define COPIAS_MAX 256
+
+// Nó imutável depois de publicado; só é alterado pela versão que o criou
+typedef struct NoC {
+  int dado;
+  int altura;
+  unsigned long versao;
+  struct NoC *esquerda;
+  struct NoC *direita;
+} NoC;
+
+// Nó fora da árvore atual que ainda pode estar sendo lido
+typedef struct {
+  NoC *no;
+  unsigned long epoca;
+} Retirado;
+
+// Época anunciada por uma leitora (0: fora de uma busca), uma por linha de cache
+typedef struct {
+  atomic_ulong epoca;
+  atomic_int ocupado; // 1: vaga entregue a uma leitora registrada
+  char preenchimento[64 - sizeof(atomic_ulong) - sizeof(atomic_int)];
+} Leitor;
+
+typedef struct ArvoreConcorrente {
+  _Atomic(NoC *) raiz;
+  atomic_ulong epoca;
+  atomic_int qtdLeitores; // Maior vaga já usada + 1: as vagas acima nunca anunciaram época
+  Leitor leitores[ARVORE_LEITORES_MAX];
+  pthread_mutex_t escrita;
+  unsigned long versao;
+  NoC *reserva; // Nós pré-alocados, encadeados pela esquerda
+  int qtdReserva;
+  Retirado *retirados;
+  size_t qtdRetirados;
+  size_t capRetirados;
+  size_t inicioVersao; // Primeiro retirado da atualização em andamento
+} ArvoreConcorrente;
+
+static int alturaC(const NoC *no) {
+  return (no == NULL) ? -1 : no->altura;
+}
+
+static void atualizaC(NoC *no) {
+  int e = alturaC(no->esquerda), d = alturaC(no->direita);
+  no->altura = ((e > d) ? e : d) + 1;
+}
+
+static int fatorC(const NoC *no) {
+  return (no == NULL) ? 0 : alturaC(no->esquerda) - alturaC(no->direita);
+}
+
+// Pega um nó da reserva; a reserva é completada antes de cada atualização, então nunca falta
+static NoC *novoNo(ArvoreConcorrente *arvore) {
+  NoC *no = arvore->reserva;
+  arvore->reserva = no->esquerda;
+  arvore->qtdReserva--;
+  no->versao = arvore->versao;
+  return no;
+}
+
+// Devolve um nó à reserva ou libera se ela já estiver cheia
+static void descartaNo(ArvoreConcorrente *arvore, NoC *no) {
+  if (arvore->qtdReserva >= 2 * COPIAS_MAX) {
+    free(no);
+    return;
+  }
+  no->esquerda = arvore->reserva;
+  arvore->reserva = no;
+  arvore->qtdReserva++;
+}
+
+// Tira um nó da árvore: se já foi publicado, espera as leitoras antes de reaproveitá-lo
+static void retiraNo(ArvoreConcorrente *arvore, NoC *no) {
+  if (no->versao == arvore->versao) descartaNo(arvore, no);
+  else arvore->retirados[arvore->qtdRetirados++].no = no;
+}
+
+// Retorna uma versão alterável do nó, copiando-o se ele pertence a uma versão publicada
+static NoC *mutavel(ArvoreConcorrente *arvore, NoC *no) {
+  if (no == NULL || no->versao == arvore->versao) return no;
+  NoC *copia = novoNo(arvore);
+  copia->dado = no->dado;
+  copia->altura = no->altura;
+  copia->esquerda = no->esquerda;
+  copia->direita = no->direita;
+  retiraNo(arvore, no);
+  return copia;
+}
+
+static NoC *rotacaoDireitaC(ArvoreConcorrente *arvore, NoC *y) {
+  NoC *x = mutavel(arvore, y->esquerda);
+  y->esquerda = x->direita;
+  x->direita = y;
+  atualizaC(y);
+  atualizaC(x);
+  return x;
+}
+
+static NoC *rotacaoEsquerdaC(ArvoreConcorrente *arvore, NoC *x) {
+  NoC *y = mutavel(arvore, x->direita);
+  x->direita = y->esquerda;
+  y->esquerda = x;
+  atualizaC(x);
+  atualizaC(y);
+  return y;
+}
+
+// Rebalanceia um nó já alterável, copiando os filhos que as rotações modificam
+static NoC *balanceiaC(ArvoreConcorrente *arvore, NoC *no) {
+  atualizaC(no);
+  int fator = fatorC(no);
+  if (fator > 1) {
+    if (fatorC(no->esquerda) < 0) no->esquerda = rotacaoEsquerdaC(arvore, mutavel(arvore, no->esquerda));
+    return rotacaoDireitaC(arvore, no);
+  }
+  if (fator < -1) {
+    if (fatorC(no->direita) > 0) no->direita = rotacaoDireitaC(arvore, mutavel(arvore, no->direita));
+    return rotacaoEsquerdaC(arvore, no);
+  }
+  return no;
+}
+
+static NoC *insereNo(ArvoreConcorrente *arvore, NoC *no, const int dado, int *alterou) {
+  if (no == NULL) {
+    NoC *novo = novoNo(arvore);
+    novo->dado = dado;
+    novo->altura = 0;
+    novo->esquerda = novo->direita = NULL;
+    *alterou = 1;
+    return novo;
+  }
+  if (dado == no->dado) return no;
+  NoC *filho = insereNo(arvore, (dado < no->dado) ? no->esquerda : no->direita, dado, alterou);
+  if (!*alterou) return no; // Nada mudou: a versão atual continua valendo
+  no = mutavel(arvore, no);
+  if (dado < no->dado) no->esquerda = filho;
+  else no->direita = filho;
+  return balanceiaC(arvore, no);
+}
+
+static NoC *removeNo(ArvoreConcorrente *arvore, NoC *no, const int dado, int *alterou) {
+  if (no == NULL) return NULL;
+  if (dado != no->dado) {
+    NoC *filho = removeNo(arvore, (dado < no->dado) ? no->esquerda : no->direita, dado, alterou);
+    if (!*alterou) return no;
+    no = mutavel(arvore, no);
+    if (dado < no->dado) no->esquerda = filho;
+    else no->direita = filho;
+    return balanceiaC(arvore, no);
+  }
+  *alterou = 1;
+  if (no->esquerda == NULL || no->direita == NULL) {
+    NoC *filho = (no->esquerda != NULL) ? no->esquerda : no->direita;
+    retiraNo(arvore, no);
+    return filho;
+  }
+  NoC *sucessor = no->direita;
+  while (sucessor->esquerda != NULL) sucessor = sucessor->esquerda;
+  int dadoSucessor = sucessor->dado, removeu = 0;
+  NoC *direita = removeNo(arvore, no->direita, dadoSucessor, &removeu);
+  no = mutavel(arvore, no);
+  no->dado = dadoSucessor;
+  no->direita = direita;
+  return balanceiaC(arvore, no);
+}
+
+// Completa a reserva de nós e o espaço de retirados p/ que a atualização não falhe no meio
+static int preparaAtualizacao(ArvoreConcorrente *arvore) {
+  while (arvore->qtdReserva < COPIAS_MAX) {
+    NoC *no = (NoC *)malloc(sizeof(NoC));
+    if (no == NULL) return 0;
+    descartaNo(arvore, no);
+  }
+  if (arvore->capRetirados - arvore->qtdRetirados < COPIAS_MAX) {
+    size_t cap = 2 * arvore->capRetirados + COPIAS_MAX;
+    Retirado *retirados = (Retirado *)realloc(arvore->retirados, cap * sizeof(Retirado));
+    if (retirados == NULL) return 0;
+    arvore->retirados = retirados;
+    arvore->capRetirados = cap;
+  }
+  arvore->versao++;
+  arvore->inicioVersao = arvore->qtdRetirados;
+  return 1;
+}
+
+// Reaproveita os nós retirados que nenhuma leitora ativa pode estar vendo
+static void recicla(ArvoreConcorrente *arvore) {
+  unsigned long minimo = ULONG_MAX;
+  int qtd = atomic_load(&arvore->qtdLeitores);
+  if (qtd > ARVORE_LEITORES_MAX) qtd = ARVORE_LEITORES_MAX;
+  for (int i = 0; i < qtd; i++) {
+    unsigned long epoca = atomic_load(&arvore->leitores[i].epoca);
+    if (epoca != 0 && epoca < minimo) minimo = epoca;
+  }
+  size_t mantidos = 0;
+  for (size_t i = 0; i < arvore->qtdRetirados; i++) {
+    if (arvore->retirados[i].epoca < minimo) descartaNo(arvore, arvore->retirados[i].no);
+    else arvore->retirados[mantidos++] = arvore->retirados[i];
+  }
+  arvore->qtdRetirados = mantidos;
+}
+
+// Publica a nova raiz, marca os nós retirados com a época atual e avança a época
+static void publica(ArvoreConcorrente *arvore, NoC *raiz) {
+  atomic_store(&arvore->raiz, raiz);
+  unsigned long epoca = atomic_fetch_add(&arvore->epoca, 1);
+  for (size_t i = arvore->inicioVersao; i < arvore->qtdRetirados; i++) arvore->retirados[i].epoca = epoca;
+  if (arvore->qtdRetirados >= COPIAS_MAX) recicla(arvore);
+}
+
+ArvoreConcorrente *arvoreConcorrenteCria() {
+  ArvoreConcorrente *arvore = (ArvoreConcorrente *)malloc(sizeof(ArvoreConcorrente));
+  if (arvore == NULL) return NULL;
+  atomic_init(&arvore->raiz, NULL);
+  atomic_init(&arvore->epoca, 1);
+  atomic_init(&arvore->qtdLeitores, 0);
+  for (int i = 0; i < ARVORE_LEITORES_MAX; i++) {
+    atomic_init(&arvore->leitores[i].epoca, 0);
+    atomic_init(&arvore->leitores[i].ocupado, 0);
+  }
+  pthread_mutex_init(&arvore->escrita, NULL);
+  arvore->versao = 0;
+  arvore->reserva = NULL;
+  arvore->qtdReserva = 0;
+  arvore->retirados = NULL;
+  arvore->qtdRetirados = arvore->capRetirados = arvore->inicioVersao = 0;
+  return arvore;
+}
+
+static void liberaNos(NoC *no) {
+  if (no == NULL) return;
+  liberaNos(no->esquerda);
+  liberaNos(no->direita);
+  free(no);
+}
+
+ArvoreConcorrente *arvoreConcorrenteLibera(ArvoreConcorrente *arvore) {
+  if (arvore == NULL) return NULL;
+  liberaNos(atomic_load(&arvore->raiz));
+  for (size_t i = 0; i < arvore->qtdRetirados; i++) free(arvore->retirados[i].no);
+  free(arvore->retirados);
+  while (arvore->reserva != NULL) {
+    NoC *prox = arvore->reserva->esquerda;
+    free(arvore->reserva);
+    arvore->reserva = prox;
+  }
+  pthread_mutex_destroy(&arvore->escrita);
+  free(arvore);
+  return NULL;
+}
+
+int arvoreConcorrenteRegistraLeitor(ArvoreConcorrente *arvore) {
+  for (int leitor = 0; leitor < ARVORE_LEITORES_MAX; leitor++) {
+    int livre = 0;
+    if (!atomic_compare_exchange_strong(&arvore->leitores[leitor].ocupado, &livre, 1)) continue;
+    int qtd = atomic_load(&arvore->qtdLeitores);
+    while (qtd <= leitor && !atomic_compare_exchange_weak(&arvore->qtdLeitores, &qtd, leitor + 1));
+    return leitor;
+  }
+  return -1;
+}
+
+int arvoreConcorrenteLiberaLeitor(ArvoreConcorrente *arvore, int leitor) {
+  if (leitor < 0 || leitor >= ARVORE_LEITORES_MAX) return 0;
+  atomic_store(&arvore->leitores[leitor].epoca, 0);
+  int ocupado = 1;
+  return atomic_compare_exchange_strong(&arvore->leitores[leitor].ocupado, &ocupado, 0);
+}
+
+int arvoreConcorrenteBusca(ArvoreConcorrente *arvore, int leitor, const int dado) {
+  if (leitor < 0 || leitor >= ARVORE_LEITORES_MAX) return -1;
+  Leitor *slot = &arvore->leitores[leitor];
+  atomic_store(&slot->epoca, atomic_load(&arvore->epoca)); // Anuncia a época antes de ler a raiz
+  const NoC *no = atomic_load(&arvore->raiz);
+  int encontrado = 0;
+  while (no != NULL) {
+    if (dado == no->dado) {
+      encontrado = 1;
+      break;
+    }
+    no = (dado < no->dado) ? no->esquerda : no->direita;
+  }
+  atomic_store_explicit(&slot->epoca, 0, memory_order_release);
+  return encontrado;
+}
+
+int arvoreConcorrenteInsere(ArvoreConcorrente *arvore, const int dado) {
+  pthread_mutex_lock(&arvore->escrita);
+  if (!preparaAtualizacao(arvore)) {
+    pthread_mutex_unlock(&arvore->escrita);
+    return 0;
+  }
+  int alterou = 0;
+  NoC *raiz = insereNo(arvore, atomic_load_explicit(&arvore->raiz, memory_order_relaxed), dado, &alterou);
+  if (alterou) publica(arvore, raiz);
+  pthread_mutex_unlock(&arvore->escrita);
+  return 1;
+}
+
+int arvoreConcorrenteRemove(ArvoreConcorrente *arvore, const int dado) {
+  pthread_mutex_lock(&arvore->escrita);
+  if (!preparaAtualizacao(arvore)) {
+    pthread_mutex_unlock(&arvore->escrita);
+    return 0;
+  }
+  int alterou = 0;
+  NoC *raiz = removeNo(arvore, atomic_load_explicit(&arvore->raiz, memory_order_relaxed), dado, &alterou);
+  if (alterou) publica(arvore, raiz);
+  pthread_mutex_unlock(&arvore->escrita);
+  return 1;
+}
@@ -0,0 +1,31 @@
+#ifndef ARVORE_CONCORRENTE_H
+#define ARVORE_CONCORRENTE_H
+
+// Quantidade máxima de threads leitoras registradas
+#define ARVORE_LEITORES_MAX 64
+
+// AVL concorrente: buscas sem trava, escritas por cópia de caminho publicadas atomicamente
+typedef struct ArvoreConcorrente ArvoreConcorrente;
+
+// Cria uma nova árvore vazia
+ArvoreConcorrente *arvoreConcorrenteCria();
+
+// Libera a árvore (nenhuma thread pode estar usando a árvore)
+ArvoreConcorrente *arvoreConcorrenteLibera(ArvoreConcorrente *arvore);
+
+// Registra uma thread leitora e retorna o seu identificador (-1 se todas as vagas estiverem ocupadas)
+int arvoreConcorrenteRegistraLeitor(ArvoreConcorrente *arvore);
+
+// Devolve a vaga da leitora p/ ser reaproveitada (0: identificador inválido ou não registrado)
+int arvoreConcorrenteLiberaLeitor(ArvoreConcorrente *arvore, int leitor);
+
+// Busca um elemento sem travar (1: encontrado, 0: não encontrado, -1: identificador de leitora inválido)
+int arvoreConcorrenteBusca(ArvoreConcorrente *arvore, int leitor, int dado);
+
+// Insere um elemento e publica a nova versão (0 se faltar memória)
+int arvoreConcorrenteInsere(ArvoreConcorrente *arvore, int dado);
+
+// Remove um elemento e publica a nova versão (0 se faltar memória)
+int arvoreConcorrenteRemove(ArvoreConcorrente *arvore, int dado);
+
+#endif
@@ -0,0 +1,197 @@
+#include <stdlib.h>
+#include "arvore_persistente.h"
+
+// Máximo de nós copiados em uma única atualização (caminho + rotações de cada nível)
+#define COPIAS_MAX 256
+
+// Nó compartilhado entre versões; 'referencias' conta os pais e as versões que apontam p/ ele
+typedef struct NoP {
+  int dado;
+  int altura;
+  int tamanho;
+  int referencias;
+  struct NoP *esquerda;
+  struct NoP *direita;
+} *ArvorePersistente;
+
+// Nós pré-alocados, encadeados pela esquerda: garantem que uma atualização não falhe no meio
+// Uma reserva por thread, então famílias de versões em threads diferentes não disputam a lista
+static _Thread_local struct NoP *reserva = NULL;
+static _Thread_local int qtdReserva = 0;
+
+static int alturaP(const struct NoP *no) {
+  return (no == NULL) ? -1 : no->altura;
+}
+
+static int tamanhoP(const struct NoP *no) {
+  return (no == NULL) ? 0 : no->tamanho;
+}
+
+static void atualizaP(struct NoP *no) {
+  int e = alturaP(no->esquerda), d = alturaP(no->direita);
+  no->altura = ((e > d) ? e : d) + 1;
+  no->tamanho = tamanhoP(no->esquerda) + tamanhoP(no->direita) + 1;
+}
+
+static int fatorP(const struct NoP *no) {
+  return (no == NULL) ? 0 : alturaP(no->esquerda) - alturaP(no->direita);
+}
+
+static struct NoP *retem(struct NoP *no) {
+  if (no != NULL) no->referencias++;
+  return no;
+}
+
+// Solta uma referência; libera o nó (e solta os filhos) quando ninguém mais aponta p/ ele
+static void solta(struct NoP *no) {
+  while (no != NULL && --no->referencias == 0) {
+    struct NoP *direita = no->direita;
+    solta(no->esquerda);
+    if (qtdReserva < 2 * COPIAS_MAX) {
+      no->esquerda = reserva;
+      reserva = no;
+      qtdReserva++;
+    } else free(no);
+    no = direita; // Continua pela direita sem recursão
+  }
+}
+
+static int preparaAtualizacao() {
+  while (qtdReserva < COPIAS_MAX) {
+    struct NoP *no = (struct NoP *)malloc(sizeof(struct NoP));
+    if (no == NULL) return 0;
+    no->esquerda = reserva;
+    reserva = no;
+    qtdReserva++;
+  }
+  return 1;
+}
+
+void arvorePersistenteLiberaReserva() {
+  while (reserva != NULL) {
+    struct NoP *no = reserva;
+    reserva = no->esquerda;
+    free(no);
+  }
+  qtdReserva = 0;
+}
+
+static struct NoP *novoNo() {
+  struct NoP *no = reserva;
+  reserva = no->esquerda;
+  qtdReserva--;
+  no->referencias = 1;
+  return no;
+}
+
+// Recebe uma referência do nó e devolve um nó exclusivo da nova versão (copiando se for compartilhado)
+static struct NoP *mutavel(struct NoP *no) {
+  if (no == NULL || no->referencias == 1) return no;
+  struct NoP *copia = novoNo();
+  copia->dado = no->dado;
+  copia->altura = no->altura;
+  copia->tamanho = no->tamanho;
+  copia->esquerda = retem(no->esquerda);
+  copia->direita = retem(no->direita);
+  solta(no);
+  return copia;
+}
+
+static struct NoP *rotacaoDireitaP(struct NoP *y) {
+  struct NoP *x = mutavel(y->esquerda);
+  y->esquerda = x->direita;
+  x->direita = y;
+  atualizaP(y);
+  atualizaP(x);
+  return x;
+}
+
+static struct NoP *rotacaoEsquerdaP(struct NoP *x) {
+  struct NoP *y = mutavel(x->direita);
+  x->direita = y->esquerda;
+  y->esquerda = x;
+  atualizaP(x);
+  atualizaP(y);
+  return y;
+}
+
+static struct NoP *balanceiaP(struct NoP *no) {
+  atualizaP(no);
+  int fator = fatorP(no);
+  if (fator > 1) {
+    if (fatorP(no->esquerda) < 0) no->esquerda = rotacaoEsquerdaP(mutavel(no->esquerda));
+    return rotacaoDireitaP(no);
+  }
+  if (fator < -1) {
+    if (fatorP(no->direita) > 0) no->direita = rotacaoDireitaP(mutavel(no->direita));
+    return rotacaoEsquerdaP(no);
+  }
+  return no;
+}
+
+// Recebe uma referência da subárvore e devolve a referência da subárvore atualizada
+static struct NoP *insereNo(struct NoP *no, const int dado) {
+  if (no == NULL) {
+    struct NoP *novo = novoNo();
+    novo->dado = dado;
+    novo->esquerda = novo->direita = NULL;
+    atualizaP(novo);
+    return novo;
+  }
+  no = mutavel(no);
+  if (dado < no->dado) no->esquerda = insereNo(no->esquerda, dado);
+  else no->direita = insereNo(no->direita, dado);
+  return balanceiaP(no);
+}
+
+static struct NoP *removeNo(struct NoP *no, const int dado) {
+  no = mutavel(no);
+  if (dado < no->dado) no->esquerda = removeNo(no->esquerda, dado);
+  else if (dado > no->dado) no->direita = removeNo(no->direita, dado);
+  else if (no->esquerda == NULL || no->direita == NULL) {
+    struct NoP *filho = retem((no->esquerda != NULL) ? no->esquerda : no->direita);
+    solta(no);
+    return filho;
+  } else {
+    const struct NoP *sucessor = no->direita;
+    while (sucessor->esquerda != NULL) sucessor = sucessor->esquerda;
+    no->dado = sucessor->dado;
+    no->direita = removeNo(no->direita, no->dado);
+  }
+  return balanceiaP(no);
+}
+
+ArvorePersistente arvorePersistenteCria() {
+  return NULL;
+}
+
+ArvorePersistente arvorePersistenteLibera(ArvorePersistente versao) {
+  solta(versao);
+  return NULL;
+}
+
+ArvorePersistente arvorePersistenteRetrato(ArvorePersistente versao) {
+  return retem(versao);
+}
+
+ArvorePersistente arvorePersistenteInsere(ArvorePersistente versao, const int dado) {
+  if (arvorePersistenteBusca(versao, dado) || !preparaAtualizacao()) return retem(versao); // Sem mudança: a nova versão é um retrato
+  return insereNo(retem(versao), dado);
+}
+
+ArvorePersistente arvorePersistenteRemove(ArvorePersistente versao, const int dado) {
+  if (!arvorePersistenteBusca(versao, dado) || !preparaAtualizacao()) return retem(versao);
+  return removeNo(retem(versao), dado);
+}
+
+int arvorePersistenteBusca(ArvorePersistente versao, const int dado) {
+  while (versao != NULL) {
+    if (dado == versao->dado) return 1;
+    versao = (dado < versao->dado) ? versao->esquerda : versao->direita;
+  }
+  return 0;
+}
+
+int arvorePersistenteTamanho(ArvorePersistente versao) {
+  return tamanhoP(versao);
+}
@@ -0,0 +1,34 @@
+#ifndef ARVORE_PERSISTENTE_H
+#define ARVORE_PERSISTENTE_H
+
+// Versão imutável de uma AVL persistente; versões diferentes compartilham as subárvores iguais
+// Cada versão obtida pelas funções abaixo deve ser liberada com 'arvorePersistenteLibera'
+// As contagens de referência não são atômicas: use cada família de versões em uma única thread
+// Cada thread tem sua própria reserva de nós, liberada com 'arvorePersistenteLiberaReserva'
+typedef struct NoP *ArvorePersistente;
+
+// Cria uma versão vazia
+ArvorePersistente arvorePersistenteCria();
+
+// Libera uma versão (os nós compartilhados com outras versões continuam vivos)
+ArvorePersistente arvorePersistenteLibera(ArvorePersistente versao);
+
+// Tira um retrato da versão em O(1)
+ArvorePersistente arvorePersistenteRetrato(ArvorePersistente versao);
+
+// Retorna uma nova versão com o elemento inserido, alocando O(log n) nós; a versão original continua válida
+ArvorePersistente arvorePersistenteInsere(ArvorePersistente versao, int dado);
+
+// Retorna uma nova versão sem o elemento, alocando O(log n) nós; a versão original continua válida
+ArvorePersistente arvorePersistenteRemove(ArvorePersistente versao, int dado);
+
+// Busca um elemento na versão (1: encontrado, 0: não encontrado)
+int arvorePersistenteBusca(ArvorePersistente versao, int dado);
+
+// Quantidade de elementos da versão
+int arvorePersistenteTamanho(ArvorePersistente versao);
+
+// Libera os nós pré-alocados da thread que chamou (ex.: antes de a thread terminar)
+void arvorePersistenteLiberaReserva();
+
+#endif
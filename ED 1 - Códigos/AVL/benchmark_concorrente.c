@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "arvore.h"
+#include "arvore_concorrente.h"
+
+// Compilar: gcc -O2 -pthread benchmark_concorrente.c arvore.c arvore_concorrente.c ../ArvoreImagem/arvore_imagem.c -o benchmark_concorrente
+// Uso: ./benchmark_concorrente [quantidade de chaves (padrão 1000000)]
+
+#define BUSCAS_POR_LEITOR 2000000
+
+static int qtdChaves;
+static atomic_int terminou;
+
+// AVL comum protegida por uma trava global (situação atual)
+static Arvore avl;
+static pthread_mutex_t trava = PTHREAD_MUTEX_INITIALIZER;
+
+// AVL concorrente com leitoras sem trava
+static ArvoreConcorrente *concorrente;
+
+static double agora() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static unsigned int proximo(unsigned int *semente) {
+  *semente ^= *semente << 13;
+  *semente ^= *semente >> 17;
+  *semente ^= *semente << 5;
+  return *semente;
+}
+
+static void *leitorTrava(void *arg) {
+  unsigned int semente = (unsigned int)(size_t)arg * 2654435761u + 1;
+  long encontrados = 0;
+  for (int i = 0; i < BUSCAS_POR_LEITOR; i++) {
+    int dado = proximo(&semente) % (2 * qtdChaves);
+    pthread_mutex_lock(&trava);
+    encontrados += arvoreBusca(avl, dado);
+    pthread_mutex_unlock(&trava);
+  }
+  return (void *)encontrados;
+}
+
+static void *escritorTrava(void *arg) {
+  unsigned int semente = 12345;
+  (void)arg;
+  while (!atomic_load(&terminou)) { // Insere e remove chaves ímpares enquanto as leitoras trabalham
+    int dado = (proximo(&semente) % qtdChaves) * 2 + 1;
+    pthread_mutex_lock(&trava);
+    avl = (semente & 1) ? arvoreInsere(avl, dado) : arvoreRemove(avl, dado);
+    pthread_mutex_unlock(&trava);
+  }
+  return NULL;
+}
+
+static void *leitorConcorrente(void *arg) {
+  unsigned int semente = (unsigned int)(size_t)arg * 2654435761u + 1;
+  int leitor = arvoreConcorrenteRegistraLeitor(concorrente);
+  long encontrados = 0;
+  if (leitor < 0) return NULL;
+  for (int i = 0; i < BUSCAS_POR_LEITOR; i++) encontrados += arvoreConcorrenteBusca(concorrente, leitor, proximo(&semente) % (2 * qtdChaves));
+  arvoreConcorrenteLiberaLeitor(concorrente, leitor);
+  return (void *)encontrados;
+}
+
+static void *escritorConcorrente(void *arg) {
+  unsigned int semente = 12345;
+  (void)arg;
+  while (!atomic_load(&terminou)) {
+    int dado = (proximo(&semente) % qtdChaves) * 2 + 1;
+    if (semente & 1) arvoreConcorrenteInsere(concorrente, dado);
+    else arvoreConcorrenteRemove(concorrente, dado);
+  }
+  return NULL;
+}
+
+// Executa 'qtd' leitoras e uma escritora e retorna milhões de buscas por segundo
+static double executa(int qtd, void *(*leitor)(void *), void *(*escritor)(void *)) {
+  pthread_t threads[qtd], threadEscritor;
+  atomic_store(&terminou, 0);
+  pthread_create(&threadEscritor, NULL, escritor, NULL);
+  double inicio = agora();
+  for (int i = 0; i < qtd; i++) pthread_create(&threads[i], NULL, leitor, (void *)(size_t)(i + 1));
+  for (int i = 0; i < qtd; i++) pthread_join(threads[i], NULL);
+  double tempo = agora() - inicio;
+  atomic_store(&terminou, 1);
+  pthread_join(threadEscritor, NULL);
+  return (double)qtd * BUSCAS_POR_LEITOR / tempo / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+  qtdChaves = (argc > 1) ? atoi(argv[1]) : 1000000;
+  if (qtdChaves <= 0) qtdChaves = 1000000;
+  int nucleos = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if (nucleos < 1) nucleos = 1;
+  if (nucleos > ARVORE_LEITORES_MAX) nucleos = ARVORE_LEITORES_MAX;
+
+  avl = arvoreCria();
+  concorrente = arvoreConcorrenteCria();
+  for (int i = 0; i < qtdChaves; i++) {
+    avl = arvoreInsere(avl, 2 * i);
+    arvoreConcorrenteInsere(concorrente, 2 * i);
+  }
+  printf("%8s | %22s | %22s\n", "leitoras", "trava global (Mbuscas/s)", "sem trava (Mbuscas/s)");
+  for (int qtd = 1; qtd <= nucleos; qtd = (qtd < nucleos && 2 * qtd > nucleos) ? nucleos : 2 * qtd) { // Dobra as leitoras e termina com todos os núcleos
+    double comTrava = executa(qtd, leitorTrava, escritorTrava);
+    double semTrava = executa(qtd, leitorConcorrente, escritorConcorrente);
+    printf("%8d | %24.2f | %22.2f\n", qtd, comTrava, semTrava);
+  }
+  concorrente = arvoreConcorrenteLibera(concorrente);
+  avl = arvoreLibera(avl);
+  return 0;
+}
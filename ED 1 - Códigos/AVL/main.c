@@ -3,6 +3,8 @@
 #include <time.h>
 #include "arvore.h"
 
+// Compilar: gcc main.c arvore.c ../ArvoreImagem/arvore_imagem.c -o main
+
 int main() {
   srand(time(NULL));
   Arvore arv = arvoreCria();
@@ -0,0 +1,263 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "arvoreb.h"
+
+// Nó da Árvore B: contador e chaves na primeira linha de cache, filhos logo em seguida
+typedef struct NoB {
+  int n;
+  int chaves[ARVOREB_MAX];
+  struct NoB *filhos[ARVOREB_MAX + 1];
+} NoB;
+
+// Estrutura do conjunto ordenado
+typedef struct ArvoreB {
+  NoB *raiz;
+  int tam;
+} ArvoreB;
+
+// Verifica se o nó é folha
+#define folha(no) ((no)->filhos[0] == NULL)
+
+// Aloca um nó vazio alinhado à linha de cache
+static NoB *noBCria() {
+  NoB *no;
+  #ifdef _WIN32
+    no = (NoB *)_aligned_malloc(sizeof(NoB), 64);
+  #else
+    no = (NoB *)aligned_alloc(64, sizeof(NoB));
+  #endif
+  if (no == NULL) return NULL;
+  no->n = 0;
+  for (int i = 0; i <= ARVOREB_MAX; i++) no->filhos[i] = NULL;
+  return no;
+}
+
+// Libera um nó alocado por 'noBCria'
+static void noBLibera(NoB *no) {
+  #ifdef _WIN32
+    _aligned_free(no);
+  #else
+    free(no);
+  #endif
+}
+
+// Posição da primeira chave >= dado (contagem sem desvios e de tamanho fixo, vetorizável)
+static int posicao(const NoB *no, const int dado) {
+  int i = 0;
+  for (int j = 0; j < ARVOREB_MAX; j++) i += (j < no->n) & (no->chaves[j] < dado);
+  return i;
+}
+
+// Cria uma nova árvore vazia
+ArvoreB *arvoreBCria() {
+  ArvoreB *arvore = (ArvoreB *)malloc(sizeof(ArvoreB));
+  if (arvore != NULL) {
+    arvore->raiz = NULL;
+    arvore->tam = 0;
+  }
+  return arvore;
+}
+
+// Libera um nó e todos os seus descendentes
+static void liberaNo(NoB *no) {
+  if (no == NULL) return;
+  if (!folha(no)) for (int i = 0; i <= no->n; i++) liberaNo(no->filhos[i]); // A altura é logarítmica, a recursão é rasa
+  noBLibera(no);
+}
+
+// Libera a memória alocada para uma árvore
+ArvoreB *arvoreBLibera(ArvoreB *arvore) {
+  if (arvore == NULL) return NULL;
+  liberaNo(arvore->raiz);
+  free(arvore);
+  return NULL;
+}
+
+// Divide o filho cheio 'i' de 'pai', subindo a chave do meio (retorna 0 se faltar memória)
+static int divideFilho(NoB *pai, const int i) {
+  NoB *cheio = pai->filhos[i];
+  NoB *novo = noBCria();
+  if (novo == NULL) return 0;
+  novo->n = ARVOREB_T - 1;
+  for (int j = 0; j < ARVOREB_T - 1; j++) novo->chaves[j] = cheio->chaves[j + ARVOREB_T]; // Metade direita das chaves vai p/ o novo nó
+  if (!folha(cheio)) {
+    for (int j = 0; j < ARVOREB_T; j++) { // Metade direita dos filhos também
+      novo->filhos[j] = cheio->filhos[j + ARVOREB_T];
+      cheio->filhos[j + ARVOREB_T] = NULL;
+    }
+  }
+  cheio->n = ARVOREB_T - 1;
+  for (int j = pai->n; j > i; j--) pai->filhos[j + 1] = pai->filhos[j]; // Abre espaço no pai
+  for (int j = pai->n - 1; j >= i; j--) pai->chaves[j + 1] = pai->chaves[j];
+  pai->filhos[i + 1] = novo;
+  pai->chaves[i] = cheio->chaves[ARVOREB_T - 1];
+  pai->n++;
+  return 1;
+}
+
+// Insere um elemento na árvore (elementos repetidos são ignorados)
+ArvoreB *arvoreBInsere(ArvoreB *arvore, const int dado) {
+  if (arvore == NULL) return NULL;
+  if (arvore->raiz == NULL) { // Árvore vazia: a raiz é uma folha com uma chave
+    NoB *raiz = noBCria();
+    if (raiz == NULL) return arvore;
+    raiz->chaves[raiz->n++] = dado;
+    arvore->raiz = raiz;
+    arvore->tam++;
+    return arvore;
+  }
+  if (arvore->raiz->n == ARVOREB_MAX) { // Raiz cheia: a árvore cresce em altura
+    NoB *raiz = noBCria();
+    if (raiz == NULL) return arvore;
+    raiz->filhos[0] = arvore->raiz;
+    if (!divideFilho(raiz, 0)) {
+      noBLibera(raiz);
+      return arvore;
+    }
+    arvore->raiz = raiz;
+  }
+  NoB *no = arvore->raiz;
+  while (1) { // Desce dividindo os nós cheios antes de entrar neles
+    int i = posicao(no, dado);
+    if (i < no->n && no->chaves[i] == dado) return arvore; // Elemento já existe
+    if (folha(no)) { // Insere na folha deslocando as chaves maiores
+      for (int j = no->n; j > i; j--) no->chaves[j] = no->chaves[j - 1];
+      no->chaves[i] = dado;
+      no->n++;
+      arvore->tam++;
+      return arvore;
+    }
+    if (no->filhos[i]->n == ARVOREB_MAX) {
+      if (!divideFilho(no, i)) return arvore;
+      if (no->chaves[i] == dado) return arvore;
+      if (no->chaves[i] < dado) i++;
+    }
+    no = no->filhos[i];
+  }
+}
+
+// Busca um elemento na árvore (1: encontrado, 0: não encontrado)
+int arvoreBBusca(const ArvoreB *arvore, const int dado) {
+  if (arvore == NULL) return 0;
+  const NoB *no = arvore->raiz;
+  while (no != NULL) { // Percorre um nó por nível
+    int i = posicao(no, dado);
+    if (i < no->n && no->chaves[i] == dado) return 1;
+    no = no->filhos[i]; // Nas folhas os filhos são 'NULL'
+  }
+  return 0;
+}
+
+// Junta o filho 'i', a chave 'i' e o filho 'i + 1' em um único nó
+static void funde(NoB *no, const int i) {
+  NoB *esq = no->filhos[i], *dir = no->filhos[i + 1];
+  esq->chaves[esq->n] = no->chaves[i];
+  for (int j = 0; j < dir->n; j++) esq->chaves[esq->n + 1 + j] = dir->chaves[j];
+  if (!folha(esq)) for (int j = 0; j <= dir->n; j++) esq->filhos[esq->n + 1 + j] = dir->filhos[j];
+  esq->n += dir->n + 1;
+  for (int j = i; j < no->n - 1; j++) no->chaves[j] = no->chaves[j + 1]; // Fecha o espaço no pai
+  for (int j = i + 1; j < no->n; j++) no->filhos[j] = no->filhos[j + 1];
+  no->filhos[no->n] = NULL;
+  no->n--;
+  noBLibera(dir);
+}
+
+// Garante que o filho 'i' tenha pelo menos T chaves antes de descer nele
+static void preenche(NoB *no, const int i) {
+  NoB *filho = no->filhos[i];
+  if (i > 0 && no->filhos[i - 1]->n >= ARVOREB_T) { // Empresta do irmão esquerdo
+    NoB *irmao = no->filhos[i - 1];
+    for (int j = filho->n; j > 0; j--) filho->chaves[j] = filho->chaves[j - 1];
+    if (!folha(filho)) for (int j = filho->n + 1; j > 0; j--) filho->filhos[j] = filho->filhos[j - 1];
+    filho->chaves[0] = no->chaves[i - 1];
+    if (!folha(filho)) {
+      filho->filhos[0] = irmao->filhos[irmao->n];
+      irmao->filhos[irmao->n] = NULL;
+    }
+    no->chaves[i - 1] = irmao->chaves[irmao->n - 1];
+    filho->n++;
+    irmao->n--;
+  } else if (i < no->n && no->filhos[i + 1]->n >= ARVOREB_T) { // Empresta do irmão direito
+    NoB *irmao = no->filhos[i + 1];
+    filho->chaves[filho->n] = no->chaves[i];
+    if (!folha(filho)) filho->filhos[filho->n + 1] = irmao->filhos[0];
+    no->chaves[i] = irmao->chaves[0];
+    for (int j = 0; j < irmao->n - 1; j++) irmao->chaves[j] = irmao->chaves[j + 1];
+    if (!folha(irmao)) {
+      for (int j = 0; j < irmao->n; j++) irmao->filhos[j] = irmao->filhos[j + 1];
+      irmao->filhos[irmao->n] = NULL;
+    }
+    filho->n++;
+    irmao->n--;
+  } else if (i < no->n) funde(no, i); // Senão junta com um irmão
+  else funde(no, i - 1);
+}
+
+// Remove 'dado' da subárvore de 'no' (1: removido, 0: não encontrado)
+static int removeDe(NoB *no, const int dado) {
+  while (1) { // Cada nó visitado tem pelo menos T chaves (exceto a raiz)
+    int i = posicao(no, dado);
+    if (i < no->n && no->chaves[i] == dado) {
+      if (folha(no)) { // Remove direto da folha
+        for (int j = i; j < no->n - 1; j++) no->chaves[j] = no->chaves[j + 1];
+        no->n--;
+        return 1;
+      }
+      NoB *esq = no->filhos[i], *dir = no->filhos[i + 1];
+      if (esq->n >= ARVOREB_T) { // Troca pelo predecessor e remove-o da esquerda
+        NoB *aux = esq;
+        while (!folha(aux)) aux = aux->filhos[aux->n];
+        no->chaves[i] = aux->chaves[aux->n - 1];
+        return removeDe(esq, no->chaves[i]);
+      }
+      if (dir->n >= ARVOREB_T) { // Troca pelo sucessor e remove-o da direita
+        NoB *aux = dir;
+        while (!folha(aux)) aux = aux->filhos[0];
+        no->chaves[i] = aux->chaves[0];
+        return removeDe(dir, no->chaves[i]);
+      }
+      funde(no, i); // Ambos os filhos no mínimo: junta e continua no nó resultante
+      no = esq;
+      continue;
+    }
+    if (folha(no)) return 0; // Não encontrou
+    if (no->filhos[i]->n < ARVOREB_T) {
+      preenche(no, i);
+      if (i > no->n) i--; // O último filho foi fundido com o anterior
+    }
+    no = no->filhos[i];
+  }
+}
+
+// Remove um elemento da árvore
+ArvoreB *arvoreBRemove(ArvoreB *arvore, const int dado) {
+  if (arvore == NULL || arvore->raiz == NULL) return arvore;
+  if (removeDe(arvore->raiz, dado)) arvore->tam--;
+  if (arvore->raiz->n == 0) { // Raiz vazia: a árvore diminui de altura
+    NoB *raiz = arvore->raiz;
+    arvore->raiz = raiz->filhos[0];
+    noBLibera(raiz);
+  }
+  return arvore;
+}
+
+// Quantidade de elementos da árvore
+int arvoreBTamanho(const ArvoreB *arvore) {
+  return (arvore == NULL) ? 0 : arvore->tam;
+}
+
+// Encontra o menor valor da árvore
+int arvoreBMenor(const ArvoreB *arvore) {
+  if (arvore == NULL || arvore->raiz == NULL) return -1; // Verifica se a árvore é vazia
+  const NoB *no = arvore->raiz;
+  while (!folha(no)) no = no->filhos[0]; // Percorre a árvore pelo primeiro filho
+  return no->chaves[0];
+}
+
+// Encontra o maior valor da árvore
+int arvoreBMaior(const ArvoreB *arvore) {
+  if (arvore == NULL || arvore->raiz == NULL) return -1; // Verifica se a árvore é vazia
+  const NoB *no = arvore->raiz;
+  while (!folha(no)) no = no->filhos[no->n]; // Percorre a árvore pelo último filho
+  return no->chaves[no->n - 1];
+}
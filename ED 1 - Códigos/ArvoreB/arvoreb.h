@@ -0,0 +1,37 @@
+#ifndef ARVOREB_H
+#define ARVOREB_H
+
+// Grau mínimo da Árvore B: cada nó guarda até 2 * T - 1 chaves
+#define ARVOREB_T 8
+
+// Máximo de chaves por nó (15 chaves + contador ocupam uma linha de cache de 64 bytes)
+#define ARVOREB_MAX (2 * ARVOREB_T - 1)
+
+// Estrutura abstrata do conjunto ordenado em Árvore B
+typedef struct ArvoreB ArvoreB;
+
+// Cria uma nova árvore vazia
+ArvoreB *arvoreBCria();
+
+// Libera a memória alocada para uma árvore
+ArvoreB *arvoreBLibera(ArvoreB *arvore);
+
+// Insere um elemento na árvore (elementos repetidos são ignorados)
+ArvoreB *arvoreBInsere(ArvoreB *arvore, int dado);
+
+// Busca um elemento na árvore (1: encontrado, 0: não encontrado)
+int arvoreBBusca(const ArvoreB *arvore, int dado);
+
+// Remove um elemento da árvore
+ArvoreB *arvoreBRemove(ArvoreB *arvore, int dado);
+
+// Quantidade de elementos da árvore
+int arvoreBTamanho(const ArvoreB *arvore);
+
+// Encontra o menor valor da árvore
+int arvoreBMenor(const ArvoreB *arvore);
+
+// Encontra o maior valor da árvore
+int arvoreBMaior(const ArvoreB *arvore);
+
+#endif
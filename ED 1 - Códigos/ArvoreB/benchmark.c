@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "arvoreb.h"
+#include "../AVL/arvore.h"
+
+// Compilar: gcc -O2 benchmark.c arvoreb.c ../AVL/arvore.c -o benchmark
+// Uso: ./benchmark [expoente máximo (3 a 8, padrão 7)]
+
+#define BUSCAS 1000000
+
+// Gerador xorshift: 'rand()' pode ter apenas 15 bits em algumas plataformas
+static unsigned int semente = 2463534242u;
+static int aleatorio() {
+  semente ^= semente << 13;
+  semente ^= semente >> 17;
+  semente ^= semente << 5;
+  return (int)(semente & 0x7fffffff);
+}
+
+static double segundos(clock_t inicio, clock_t fim) {
+  return (double)(fim - inicio) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[]) {
+  int maxExp = (argc > 1) ? atoi(argv[1]) : 7;
+  if (maxExp < 3 || maxExp > 8) maxExp = 7;
+  int *buscas = (int *)malloc(BUSCAS * sizeof(int));
+  if (buscas == NULL) return 1;
+
+  printf("%12s | %14s %14s | %14s %14s\n", "chaves", "AVL ins (s)", "AVL Mbuscas/s", "ArvB ins (s)", "ArvB Mbuscas/s");
+  for (int e = 3, n = 1000; e <= maxExp; e++, n *= 10) {
+    int *chaves = (int *)malloc((size_t)n * sizeof(int));
+    if (chaves == NULL) break;
+    for (int i = 0; i < n; i++) chaves[i] = aleatorio();
+    for (int i = 0; i < BUSCAS; i++) buscas[i] = (i % 2 == 0) ? chaves[aleatorio() % n] : aleatorio(); // Metade presente, metade aleatória
+    clock_t inicio, fim;
+    volatile int encontrados = 0;
+
+    Arvore avl = arvoreCria();
+    inicio = clock();
+    for (int i = 0; i < n; i++) avl = arvoreInsere(avl, chaves[i]);
+    fim = clock();
+    double avlInsere = segundos(inicio, fim);
+    inicio = clock();
+    for (int i = 0; i < BUSCAS; i++) encontrados += arvoreBusca(avl, buscas[i]);
+    fim = clock();
+    double avlBusca = BUSCAS / segundos(inicio, fim) / 1e6;
+    avl = arvoreLibera(avl);
+
+    ArvoreB *arvb = arvoreBCria();
+    inicio = clock();
+    for (int i = 0; i < n; i++) arvb = arvoreBInsere(arvb, chaves[i]);
+    fim = clock();
+    double arvbInsere = segundos(inicio, fim);
+    inicio = clock();
+    for (int i = 0; i < BUSCAS; i++) encontrados += arvoreBBusca(arvb, buscas[i]);
+    fim = clock();
+    double arvbBusca = BUSCAS / segundos(inicio, fim) / 1e6;
+    arvb = arvoreBLibera(arvb);
+
+    printf("%12d | %14.4f %14.2f | %14.4f %14.2f\n", n, avlInsere, avlBusca, arvbInsere, arvbBusca);
+    free(chaves);
+  }
+  free(buscas);
+  return 0;
+}
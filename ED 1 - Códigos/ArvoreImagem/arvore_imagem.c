@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+#include "arvore_imagem.h"
+
+// Cabeçalho da imagem binária da árvore
+typedef struct {
+  char assinatura[4]; // "ARV1"
+  uint32_t marca;     // 0x01020304 na ordem de bytes de quem salvou
+  uint64_t qtd;       // Quantidade de nós
+} CabecalhoImagem;
+
+// Imagem da árvore mapeada em memória
+typedef struct ArvoreImagem {
+  void *mapa;
+  size_t bytes;
+  const NoImagem *nos;
+  size_t qtd;
+  #ifdef _WIN32
+    HANDLE arquivo;
+    HANDLE mapeamento;
+  #endif
+} ArvoreImagem;
+
+// Grava o cabeçalho e os 'qtd' nós em um arquivo binário
+int arvoreImagemGrava(const char *nome_arqv, const NoImagem *nos, size_t qtd) {
+  FILE *arquivo = fopen(nome_arqv, "wb");
+  if (arquivo == NULL) return -1; // Verifica se o arquivo foi aberto com sucesso
+  CabecalhoImagem cabecalho = {{'A', 'R', 'V', '1'}, 0x01020304u, (uint64_t)qtd};
+  int ok = fwrite(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1 && fwrite(nos, sizeof(NoImagem), qtd, arquivo) == qtd;
+  ok = (fclose(arquivo) == 0) && ok;
+  return ok ? 1 : -1;
+}
+
+// Mapeia a imagem de uma árvore em memória p/ consultas sem alocar nós
+ArvoreImagem *arvoreImagemAbre(const char *nome_arqv) {
+  ArvoreImagem *imagem = (ArvoreImagem *)malloc(sizeof(ArvoreImagem));
+  if (imagem == NULL) return NULL;
+  #ifdef _WIN32
+    imagem->arquivo = CreateFileA(nome_arqv, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER tamanho;
+    if (imagem->arquivo == INVALID_HANDLE_VALUE || !GetFileSizeEx(imagem->arquivo, &tamanho)) {
+      if (imagem->arquivo != INVALID_HANDLE_VALUE) CloseHandle(imagem->arquivo);
+      free(imagem);
+      return NULL;
+    }
+    imagem->bytes = (size_t)tamanho.QuadPart;
+    imagem->mapeamento = CreateFileMappingA(imagem->arquivo, NULL, PAGE_READONLY, 0, 0, NULL);
+    imagem->mapa = (imagem->mapeamento != NULL) ? MapViewOfFile(imagem->mapeamento, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (imagem->mapa == NULL) {
+      if (imagem->mapeamento != NULL) CloseHandle(imagem->mapeamento);
+      CloseHandle(imagem->arquivo);
+      free(imagem);
+      return NULL;
+    }
+  #else
+    int arquivo = open(nome_arqv, O_RDONLY);
+    struct stat info;
+    if (arquivo < 0 || fstat(arquivo, &info) != 0 || info.st_size < (off_t)sizeof(CabecalhoImagem)) {
+      if (arquivo >= 0) close(arquivo);
+      free(imagem);
+      return NULL;
+    }
+    imagem->bytes = (size_t)info.st_size;
+    imagem->mapa = mmap(NULL, imagem->bytes, PROT_READ, MAP_SHARED, arquivo, 0);
+    close(arquivo); // O mapeamento continua válido depois de fechar o descritor
+    if (imagem->mapa == MAP_FAILED) {
+      free(imagem);
+      return NULL;
+    }
+  #endif
+  const CabecalhoImagem *cabecalho = (const CabecalhoImagem *)imagem->mapa;
+  if (imagem->bytes < sizeof(CabecalhoImagem) || memcmp(cabecalho->assinatura, "ARV1", 4) != 0 || cabecalho->marca != 0x01020304u ||
+      cabecalho->qtd > (imagem->bytes - sizeof(CabecalhoImagem)) / sizeof(NoImagem) || cabecalho->qtd > INT32_MAX) { // Valida o cabeçalho
+    arvoreImagemFecha(imagem);
+    return NULL;
+  }
+  imagem->nos = (const NoImagem *)(cabecalho + 1);
+  imagem->qtd = (size_t)cabecalho->qtd;
+  return imagem;
+}
+
+// Desfaz o mapeamento da imagem
+ArvoreImagem *arvoreImagemFecha(ArvoreImagem *imagem) {
+  if (imagem == NULL) return NULL;
+  #ifdef _WIN32
+    UnmapViewOfFile(imagem->mapa);
+    CloseHandle(imagem->mapeamento);
+    CloseHandle(imagem->arquivo);
+  #else
+    munmap(imagem->mapa, imagem->bytes);
+  #endif
+  free(imagem);
+  return NULL;
+}
+
+// Quantidade de nós da imagem
+size_t arvoreImagemTamanho(const ArvoreImagem *imagem) {
+  return (imagem == NULL) ? 0 : imagem->qtd;
+}
+
+// Nós da imagem, lidos direto do mapeamento
+const NoImagem *arvoreImagemNos(const ArvoreImagem *imagem) {
+  return (imagem == NULL) ? NULL : imagem->nos;
+}
+
+// Busca um elemento direto na imagem (1: encontrado, 0: não encontrado, -1: imagem corrompida)
+int arvoreImagemBusca(const ArvoreImagem *imagem, const int dado) {
+  if (imagem == NULL || imagem->qtd == 0) return 0;
+  int32_t i = 0;
+  while (i >= 0) { // Percorre a imagem como a árvore original
+    const NoImagem *no = &imagem->nos[i];
+    if (dado == no->dado) return 1;
+    int32_t prox = (dado < no->dado) ? no->esquerda : no->direita;
+    if (prox >= 0 && (prox <= i || (size_t)prox >= imagem->qtd)) return -1; // Filhos sempre depois do pai: evita ciclos
+    i = prox;
+  }
+  return 0;
+}
@@ -0,0 +1,37 @@
+#ifndef ARVORE_IMAGEM_H
+#define ARVORE_IMAGEM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Imagem binária de uma árvore de busca ("ARV1"), comum à ABP e à AVL: um cabeçalho e os nós em pré-ordem
+
+// Nó da imagem em pré-ordem: os filhos sempre têm índice maior que o pai (-1: sem filho)
+typedef struct {
+  int32_t dado;
+  int32_t esquerda;
+  int32_t direita;
+} NoImagem;
+
+// Imagem de uma árvore mapeada em memória (consultas sem alocar nós)
+typedef struct ArvoreImagem ArvoreImagem;
+
+// Grava o cabeçalho e os 'qtd' nós em um arquivo binário (1: ok, -1: erro)
+int arvoreImagemGrava(const char *nome_arqv, const NoImagem *nos, size_t qtd);
+
+// Mapeia a imagem de uma árvore em memória p/ consultas sem alocar nós
+ArvoreImagem *arvoreImagemAbre(const char *nome_arqv);
+
+// Desfaz o mapeamento da imagem
+ArvoreImagem *arvoreImagemFecha(ArvoreImagem *imagem);
+
+// Quantidade de nós da imagem
+size_t arvoreImagemTamanho(const ArvoreImagem *imagem);
+
+// Nós da imagem, lidos direto do mapeamento (válidos até 'arvoreImagemFecha')
+const NoImagem *arvoreImagemNos(const ArvoreImagem *imagem);
+
+// Busca um elemento direto na imagem (1: encontrado, 0: não encontrado, -1: imagem corrompida)
+int arvoreImagemBusca(const ArvoreImagem *imagem, int dado);
+
+#endif
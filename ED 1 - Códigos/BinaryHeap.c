@@ -1,30 +1,76 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include "FilaPrioridade/fila_prioridade.h"
 
-#define MAX 1000
+// Compilar: gcc -O2 BinaryHeap.c FilaPrioridade/fila_prioridade.c -o BinaryHeap
+
+#define CAPACIDADE_INICIAL 64
+#define TAM_BUFFER (1 << 16)
 
 typedef struct {
-  int dados[MAX];
+  int *dados;
   int topo;
+  int capacidade;
 } Pilha;
 
+// Fila circular: só guarda os elementos vivos, então a memória não cresce com o total de operações
 typedef struct {
-  int dados[MAX];
+  int *dados;
   int cauda;
-  int cabeca;
+  int tam;
+  int capacidade;
 } Fila;
 
-typedef struct {
-  int dados[MAX];
-  int tam;
-} FilaPrioridade;
+// Leitura com buffer próprio: o scanf é o gargalo p/ dezenas de milhões de operações
+static char buffer[TAM_BUFFER];
+static size_t posBuffer = 0, tamBuffer = 0;
+
+static int proximoCaractere() {
+  if (posBuffer == tamBuffer) {
+    tamBuffer = fread(buffer, 1, TAM_BUFFER, stdin);
+    posBuffer = 0;
+    if (tamBuffer == 0) return EOF;
+  }
+  return (unsigned char)buffer[posBuffer++];
+}
+
+// Lê o próximo inteiro da entrada (0: fim da entrada)
+int leInteiro(int *x) {
+  int c = proximoCaractere(), negativo = 0;
+  while (c != EOF && c != '-' && (c < '0' || c > '9')) c = proximoCaractere();
+  if (c == EOF) return 0;
+  if (c == '-') {
+    negativo = 1;
+    c = proximoCaractere();
+  }
+  long valor = 0;
+  for (; c >= '0' && c <= '9'; c = proximoCaractere()) valor = valor * 10 + (c - '0');
+  *x = (int)(negativo ? -valor : valor);
+  return 1;
+}
 
 void pilhaCria(Pilha* pilha) { 
+  pilha->dados = NULL;
   pilha->topo = -1; 
+  pilha->capacidade = 0;
+}
+
+void pilhaLibera(Pilha* pilha) {
+  free(pilha->dados);
+  pilhaCria(pilha);
 }
 
-void pilhaAdiciona(Pilha* pilha, int x) { 
+int pilhaAdiciona(Pilha* pilha, int x) { 
+  if (pilha->topo + 1 == pilha->capacidade) {
+    int capacidade = (pilha->capacidade > 0) ? 2 * pilha->capacidade : CAPACIDADE_INICIAL;
+    int *dados = (int *)realloc(pilha->dados, capacidade * sizeof(int));
+    if (dados == NULL) return 0;
+    pilha->dados = dados;
+    pilha->capacidade = capacidade;
+  }
   pilha->dados[++pilha->topo] = x; 
+  return 1;
 }
 
 int pilhaRemove(Pilha* pilha) { 
@@ -32,69 +78,83 @@ int pilhaRemove(Pilha* pilha) {
 }
 
 void filaCria(Fila* fila) { 
-  fila->cauda = fila->cabeca = -1; 
+  fila->dados = NULL;
+  fila->cauda = fila->tam = fila->capacidade = 0;
+}
+
+void filaLibera(Fila* fila) {
+  free(fila->dados);
+  filaCria(fila);
 }
 
-void filaAdiciona(Fila* fila, int x) {
-  if (fila->cabeca == -1) fila->cauda = fila->cabeca = 0;
-  else fila->cabeca++;
-  fila->dados[fila->cabeca] = x;
+int filaAdiciona(Fila* fila, int x) {
+  if (fila->tam == fila->capacidade) { // Dobra e desenrola o anel no novo vetor
+    int capacidade = (fila->capacidade > 0) ? 2 * fila->capacidade : CAPACIDADE_INICIAL;
+    int *dados = (int *)malloc(capacidade * sizeof(int));
+    if (dados == NULL) return 0;
+    for (int i = 0; i < fila->tam; i++) dados[i] = fila->dados[(fila->cauda + i) % fila->capacidade];
+    free(fila->dados);
+    fila->dados = dados;
+    fila->cauda = 0;
+    fila->capacidade = capacidade;
+  }
+  int cabeca = fila->cauda + fila->tam++;
+  if (cabeca >= fila->capacidade) cabeca -= fila->capacidade;
+  fila->dados[cabeca] = x;
+  return 1;
 }
 
 int filaRemove(Fila *fila) {
   int x = fila->dados[fila->cauda];
-  if (fila->cauda == fila->cabeca) fila->cauda = fila->cabeca = -1;
-  else fila->cauda++;
+  if (++fila->cauda == fila->capacidade) fila->cauda = 0;
+  fila->tam--;
   return x;
 }
-void filaPrioridadeCria(FilaPrioridade *fP) { 
-  fP->tam = 0; 
-}
 
-void filaPrioridadeAdiciona(FilaPrioridade* fP, int x) {
-  int i = fP->tam++;
-  while (i > 0 && fP->dados[(i - 1) / 2] < x) {
-    fP->dados[i] = fP->dados[(i - 1) / 2];
-    i = (i - 1) / 2;
-  }
-  fP->dados[i] = x;
-}
-int filaPrioridadeMaximo(FilaPrioridade* fP) {
-  int maximo = fP->dados[0];
-  fP->dados[0] = fP->dados[--fP->tam];
-  int i = 0, j;
-  while (2 * i + 1 < fP->tam) {
-    j = 2 * i + 1;
-    if (j + 1 < fP->tam && fP->dados[j + 1] > fP->dados[j]) j++;
-    if (fP->dados[i] >= fP->dados[j]) break;
-    int temp = fP->dados[i];
-    fP->dados[i] = fP->dados[j];
-    fP->dados[j] = temp;
-    i = j;
-  }
-  return maximo;
+// Os inteiros são guardados na fila dentro do próprio ponteiro
+int comparaInteiro(const void *a, const void *b) {
+  intptr_t x = (intptr_t)a, y = (intptr_t)b;
+  return (x > y) - (x < y);
 }
-void saida(int n, int operacoes[][2]) {
+
+// Lê e processa 'n' operações da entrada; cada estrutura deixa de ser simulada (e é liberada) assim que é descartada
+void saida(int n) {
   Pilha pilha;
   Fila fila;
-  FilaPrioridade filaPrioridade;
-  int auxPilha = 1, auxFila = 1, auxFilaPrioridade = 1;
+  FilaPrioridade *filaPrioridade = filaPrioridadeCria(comparaInteiro, FILA_PRIORIDADE_MAX);
+  int auxPilha = 1, auxFila = 1, auxFilaPrioridade = (filaPrioridade != NULL);
 
   pilhaCria(&pilha);
   filaCria(&fila);
-  filaPrioridadeCria(&filaPrioridade);
 
   for (int i = 0; i < n; i++) {
-    if (operacoes[i][0] == 1) {
-      pilhaAdiciona(&pilha, operacoes[i][1]);
-      filaAdiciona(&fila, operacoes[i][1]);
-      filaPrioridadeAdiciona(&filaPrioridade, operacoes[i][1]);
+    int tipo, x;
+    if (!leInteiro(&tipo) || !leInteiro(&x)) break;
+    if (!auxPilha && !auxFila && !auxFilaPrioridade) continue; // Já é impossível: só consome a entrada
+    if (tipo == 1) {
+      if ((auxPilha && !pilhaAdiciona(&pilha, x)) || (auxFila && !filaAdiciona(&fila, x)) ||
+          (auxFilaPrioridade && filaPrioridadeInsere(filaPrioridade, (void *)(intptr_t)x) < 0)) {
+        fprintf(stderr, "Memória insuficiente\n");
+        exit(1);
+      }
     } else {
-      if (auxPilha && (pilha.topo == -1 || pilhaRemove(&pilha) != operacoes[i][1])) auxPilha = 0;
-      if (auxFila && (fila.cauda == -1 || filaRemove(&fila) != operacoes[i][1])) auxFila = 0;
-      if (auxFilaPrioridade && (filaPrioridade.tam == 0 || filaPrioridadeMaximo(&filaPrioridade) != operacoes[i][1])) auxFilaPrioridade = 0;
+      if (auxPilha && (pilha.topo == -1 || pilhaRemove(&pilha) != x)) {
+        auxPilha = 0;
+        pilhaLibera(&pilha);
+      }
+      if (auxFila && (fila.tam == 0 || filaRemove(&fila) != x)) {
+        auxFila = 0;
+        filaLibera(&fila);
+      }
+      if (auxFilaPrioridade && (filaPrioridadeVazia(filaPrioridade) || (intptr_t)filaPrioridadeRemove(filaPrioridade) != x)) {
+        auxFilaPrioridade = 0;
+        filaPrioridade = filaPrioridadeLibera(filaPrioridade);
+      }
     }
   }
+  pilhaLibera(&pilha);
+  filaLibera(&fila);
+  filaPrioridade = filaPrioridadeLibera(filaPrioridade);
 
   if (auxPilha && !auxFila && !auxFilaPrioridade) printf("stack\n");
   else if (!auxPilha && auxFila && !auxFilaPrioridade) printf("queue\n");
@@ -104,12 +164,8 @@ void saida(int n, int operacoes[][2]) {
 }
 int main() {
   int n;
-  int operacoes[MAX][2];
 
-  while (scanf("%d", &n) != EOF) {
-    for (int i = 0; i < n; i++) scanf("%d %d", &operacoes[i][0], &operacoes[i][1]);
-    saida(n, operacoes);
-  }
+  while (leInteiro(&n)) saida(n);
 
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "fila_prioridade.h"
+#include "heap_dario.h"
+
+// Compilar: gcc -O2 benchmark.c fila_prioridade.c heap_dario.c -o benchmark
+// Uso: ./benchmark [expoente máximo (3 a 8, padrão 7)]
+
+// Operações mínimas por medida: os tamanhos pequenos são repetidos p/ o tempo ser mensurável
+#define OPERACOES_MIN 10000000
+
+static const char *distribuicoes[] = {"aleatória", "crescente", "decrescente", "repetidas"};
+
+// Gerador xorshift: 'rand()' pode ter apenas 15 bits em algumas plataformas
+static unsigned int semente = 2463534242u;
+static int aleatorio() {
+  semente ^= semente << 13;
+  semente ^= semente >> 17;
+  semente ^= semente << 5;
+  return (int)(semente & 0x7fffffff);
+}
+
+static void geraChaves(int *chaves, int n, int distribuicao) {
+  for (int i = 0; i < n; i++) {
+    switch (distribuicao) {
+      case 0: chaves[i] = aleatorio(); break;
+      case 1: chaves[i] = i; break;
+      case 2: chaves[i] = n - i; break;
+      default: chaves[i] = aleatorio() % 16; // Poucas chaves distintas
+    }
+  }
+}
+
+static int comparaInteiro(const void *a, const void *b) {
+  intptr_t x = (intptr_t)a, y = (intptr_t)b;
+  return (x > y) - (x < y);
+}
+
+static double agora() {
+  return (double)clock() / CLOCKS_PER_SEC;
+}
+
+// Resultado de uma medida em milhões de operações por segundo
+typedef struct {
+  double insere;
+  double remove;
+} Medida;
+
+static Medida mede(const int *chaves, int n, int rodadas, int aridade, long *verificacao) {
+  Medida medida = {0, 0};
+  double tInsere = 0, tRemove = 0;
+  for (int r = 0; r < rodadas; r++) {
+    double inicio, meio;
+    int dado;
+    if (aridade == 0) { // Fila genérica do BinaryHeap.c
+      FilaPrioridade *fila = filaPrioridadeCria(comparaInteiro, FILA_PRIORIDADE_MAX);
+      inicio = agora();
+      for (int i = 0; i < n; i++) filaPrioridadeInsere(fila, (void *)(intptr_t)chaves[i]);
+      meio = agora();
+      while (!filaPrioridadeVazia(fila)) *verificacao += (intptr_t)filaPrioridadeRemove(fila);
+      fila = filaPrioridadeLibera(fila);
+    } else {
+      HeapDario *heap = heapDarioCria(aridade);
+      inicio = agora();
+      for (int i = 0; i < n; i++) heapDarioInsere(heap, chaves[i]);
+      meio = agora();
+      while (heapDarioRemove(heap, &dado)) *verificacao += dado;
+      heap = heapDarioLibera(heap);
+    }
+    tInsere += meio - inicio;
+    tRemove += agora() - meio;
+  }
+  if (tInsere > 0) medida.insere = (double)n * rodadas / tInsere / 1e6;
+  if (tRemove > 0) medida.remove = (double)n * rodadas / tRemove / 1e6;
+  return medida;
+}
+
+int main(int argc, char *argv[]) {
+  int maxExp = (argc > 1) ? atoi(argv[1]) : 7;
+  if (maxExp < 3 || maxExp > 8) maxExp = 7;
+  const int aridades[] = {0, 2, 4, 8};
+
+  printf("Milhões de operações por segundo (inserção / remoção do máximo)\n");
+  printf("%10s %-12s | %15s | %15s | %15s | %15s\n", "chaves", "distribuição", "genérica", "binário", "4-ário", "8-ário");
+  for (int e = 3, n = 1000; e <= maxExp; e++, n *= 10) {
+    int *chaves = (int *)malloc((size_t)n * sizeof(int));
+    if (chaves == NULL) break;
+    int rodadas = (n < OPERACOES_MIN) ? OPERACOES_MIN / n : 1;
+    for (int d = 0; d < 4; d++) {
+      long verificacao[4] = {0, 0, 0, 0};
+      geraChaves(chaves, n, d);
+      printf("%10d %-12s", n, distribuicoes[d]);
+      for (int a = 0; a < 4; a++) {
+        if (aridades[a] == 0 && e > 7) { // A fila genérica guarda 16 bytes por elemento + alças: pula 10^8
+          printf(" | %15s", "-");
+          continue;
+        }
+        Medida medida = mede(chaves, n, rodadas, aridades[a], &verificacao[a]);
+        printf(" | %7.1f/%-7.1f", medida.insere, medida.remove);
+        fflush(stdout);
+      }
+      for (int a = 2; a < 4; a++) if (verificacao[a] != verificacao[1]) printf(" (soma divergente!)");
+      printf("\n");
+    }
+    free(chaves);
+  }
+  return 0;
+}
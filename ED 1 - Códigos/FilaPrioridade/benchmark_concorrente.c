@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "fila_prioridade.h"
+#include "fila_concorrente.h"
+
+// Compilar: gcc -O2 -pthread benchmark_concorrente.c fila_prioridade.c fila_concorrente.c -o benchmark_concorrente
+// Uso: ./benchmark_concorrente [elementos iniciais (padrão 1000000)]
+
+#define OPERACOES_POR_THREAD 2000000
+
+// FilaPrioridade comum protegida por uma trava global (situação atual)
+static FilaPrioridade *filaTrava;
+static pthread_mutex_t trava = PTHREAD_MUTEX_INITIALIZER;
+
+static FilaConcorrente *filaConcorrente;
+
+static double agora() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static unsigned int proximo(unsigned int *semente) {
+  *semente ^= *semente << 13;
+  *semente ^= *semente >> 17;
+  *semente ^= *semente << 5;
+  return *semente;
+}
+
+static int comparaInteiro(const void *a, const void *b) {
+  intptr_t x = (intptr_t)a, y = (intptr_t)b;
+  return (x > y) - (x < y);
+}
+
+// Cada thread alterna inserções e remoções, como um escalonador que gera e consome tarefas
+static void *trabalhaTrava(void *arg) {
+  unsigned int semente = (unsigned int)(size_t)arg * 2654435761u + 1;
+  for (int i = 0; i < OPERACOES_POR_THREAD / 2; i++) {
+    pthread_mutex_lock(&trava);
+    filaPrioridadeInsere(filaTrava, (void *)(intptr_t)(proximo(&semente) % 1000000));
+    pthread_mutex_unlock(&trava);
+    pthread_mutex_lock(&trava);
+    filaPrioridadeRemove(filaTrava);
+    pthread_mutex_unlock(&trava);
+  }
+  return NULL;
+}
+
+static void *trabalhaConcorrente(void *arg) {
+  unsigned int semente = (unsigned int)(size_t)arg * 2654435761u + 1;
+  for (int i = 0; i < OPERACOES_POR_THREAD / 2; i++) {
+    filaConcorrenteInsere(filaConcorrente, proximo(&semente) % 1000000, NULL);
+    filaConcorrenteRemove(filaConcorrente, NULL, NULL);
+  }
+  return NULL;
+}
+
+// Executa 'qtd' threads e retorna milhões de operações por segundo
+static double executa(int qtd, void *(*trabalho)(void *)) {
+  pthread_t threads[qtd];
+  double inicio = agora();
+  for (int i = 0; i < qtd; i++) pthread_create(&threads[i], NULL, trabalho, (void *)(size_t)(i + 1));
+  for (int i = 0; i < qtd; i++) pthread_join(threads[i], NULL);
+  return (double)qtd * OPERACOES_POR_THREAD / (agora() - inicio) / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+  int iniciais = (argc > 1) ? atoi(argv[1]) : 1000000;
+  if (iniciais < 0) iniciais = 1000000;
+  int nucleos = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if (nucleos < 1) nucleos = 1;
+
+  printf("%8s | %22s | %22s\n", "threads", "trava global (Mops/s)", "MultiQueue (Mops/s)");
+  for (int qtd = 1; qtd <= nucleos; qtd = (qtd < nucleos && 2 * qtd > nucleos) ? nucleos : 2 * qtd) { // Dobra as threads e termina com todos os núcleos
+    unsigned int semente = 42;
+    filaTrava = filaPrioridadeCria(comparaInteiro, FILA_PRIORIDADE_MIN);
+    filaConcorrente = filaConcorrenteCria(qtd);
+    if (filaTrava == NULL || filaConcorrente == NULL) return 1;
+    for (int i = 0; i < iniciais; i++) {
+      int prioridade = proximo(&semente) % 1000000;
+      filaPrioridadeInsere(filaTrava, (void *)(intptr_t)prioridade);
+      filaConcorrenteInsere(filaConcorrente, prioridade, NULL);
+    }
+    double comTrava = executa(qtd, trabalhaTrava);
+    double multiQueue = executa(qtd, trabalhaConcorrente);
+    printf("%8d | %22.2f | %22.2f\n", qtd, comTrava, multiQueue);
+    filaTrava = filaPrioridadeLibera(filaTrava);
+    filaConcorrente = filaConcorrenteLibera(filaConcorrente);
+  }
+  return 0;
+}
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <time.h>
+#include "fila_prioridade.h"
+#include "heap_pareamento.h"
+
+// Compilar: gcc -O2 benchmark_dijkstra.c fila_prioridade.c heap_pareamento.c -o benchmark_dijkstra
+// Uso: ./benchmark_dijkstra [vértices (padrão 1000000)] [arestas por vértice (padrão 8)]
+
+// Grafo em listas de adjacência compactas (CSR): as arestas de v ficam em destino[inicio[v] .. inicio[v + 1] - 1]
+typedef struct {
+  int n;
+  int *inicio;
+  int *destino;
+  int *peso;
+} Grafo;
+
+// Gerador xorshift: 'rand()' pode ter apenas 15 bits em algumas plataformas
+static unsigned int semente = 2463534242u;
+static int aleatorio() {
+  semente ^= semente << 13;
+  semente ^= semente >> 17;
+  semente ^= semente << 5;
+  return (int)(semente & 0x7fffffff);
+}
+
+static double agora() {
+  return (double)clock() / CLOCKS_PER_SEC;
+}
+
+// Grafo aleatório com um caminho 0 -> 1 -> ... -> n - 1 p/ que todos os vértices sejam alcançáveis
+static int geraGrafo(Grafo *grafo, int n, int grau) {
+  grafo->n = n;
+  grafo->inicio = (int *)malloc(((size_t)n + 1) * sizeof(int));
+  grafo->destino = (int *)malloc((size_t)n * grau * sizeof(int));
+  grafo->peso = (int *)malloc((size_t)n * grau * sizeof(int));
+  if (grafo->inicio == NULL || grafo->destino == NULL || grafo->peso == NULL) return 0;
+  for (int v = 0, a = 0; v < n; v++) {
+    grafo->inicio[v] = a;
+    for (int k = 0; k < grau; a++, k++) {
+      grafo->destino[a] = (k == 0) ? (v + 1) % n : aleatorio() % n;
+      grafo->peso[a] = 1 + aleatorio() % 1000;
+    }
+  }
+  grafo->inicio[n] = n * grau;
+  return 1;
+}
+
+static int comparaDistancia(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+// Dijkstra com a fila genérica: cada elemento aponta p/ a distância do vértice, e a redução usa a alça
+static void dijkstraFila(const Grafo *grafo, int *distancia) {
+  int *alca = (int *)malloc(grafo->n * sizeof(int));
+  FilaPrioridade *fila = filaPrioridadeCria(comparaDistancia, FILA_PRIORIDADE_MIN);
+  for (int v = 0; v < grafo->n; v++) {
+    distancia[v] = INT_MAX;
+    alca[v] = -1;
+  }
+  distancia[0] = 0;
+  alca[0] = filaPrioridadeInsere(fila, &distancia[0]);
+  while (!filaPrioridadeVazia(fila)) {
+    int v = (int)((int *)filaPrioridadeRemove(fila) - distancia);
+    for (int a = grafo->inicio[v]; a < grafo->inicio[v + 1]; a++) {
+      int w = grafo->destino[a], nova = distancia[v] + grafo->peso[a];
+      if (nova >= distancia[w]) continue;
+      int novo = distancia[w] == INT_MAX;
+      distancia[w] = nova;
+      if (novo) alca[w] = filaPrioridadeInsere(fila, &distancia[w]);
+      else filaPrioridadeAtualiza(fila, alca[w], &distancia[w]);
+    }
+  }
+  fila = filaPrioridadeLibera(fila);
+  free(alca);
+}
+
+static void dijkstraPareamento(const Grafo *grafo, int *distancia) {
+  NoPareamento **no = (NoPareamento **)malloc(grafo->n * sizeof(NoPareamento *));
+  HeapPareamento *heap = heapPareamentoCria();
+  for (int v = 0; v < grafo->n; v++) distancia[v] = INT_MAX;
+  distancia[0] = 0;
+  no[0] = heapPareamentoInsere(heap, 0, (void *)&distancia[0]);
+  void *dado;
+  while (heapPareamentoRemoveMinimo(heap, NULL, &dado)) {
+    int v = (int)((int *)dado - distancia);
+    for (int a = grafo->inicio[v]; a < grafo->inicio[v + 1]; a++) {
+      int w = grafo->destino[a], nova = distancia[v] + grafo->peso[a];
+      if (nova >= distancia[w]) continue;
+      if (distancia[w] == INT_MAX) no[w] = heapPareamentoInsere(heap, nova, &distancia[w]);
+      else heapPareamentoDiminui(heap, no[w], nova);
+      distancia[w] = nova;
+    }
+  }
+  heap = heapPareamentoLibera(heap);
+  free(no);
+}
+
+int main(int argc, char *argv[]) {
+  int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+  int grau = (argc > 2) ? atoi(argv[2]) : 8;
+  if (n < 2) n = 1000000;
+  if (grau < 1) grau = 8;
+
+  Grafo grafo;
+  int *distFila = (int *)malloc(n * sizeof(int)), *distPareamento = (int *)malloc(n * sizeof(int));
+  if (distFila == NULL || distPareamento == NULL || !geraGrafo(&grafo, n, grau)) {
+    printf("Memória insuficiente\n");
+    return 1;
+  }
+
+  double inicio = agora();
+  dijkstraFila(&grafo, distFila);
+  double tempoFila = agora() - inicio;
+  inicio = agora();
+  dijkstraPareamento(&grafo, distPareamento);
+  double tempoPareamento = agora() - inicio;
+
+  int iguais = 1;
+  for (int v = 0; v < n; v++) if (distFila[v] != distPareamento[v]) iguais = 0;
+  printf("Dijkstra em %d vértices e %d arestas\n", n, n * grau);
+  printf("%-22s %8.3f s\n", "FilaPrioridade", tempoFila);
+  printf("%-22s %8.3f s\n", "Heap de pareamento", tempoPareamento);
+  printf("Distâncias %s\n", iguais ? "iguais" : "DIFERENTES");
+
+  free(grafo.inicio);
+  free(grafo.destino);
+  free(grafo.peso);
+  free(distFila);
+  free(distPareamento);
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "fila_concorrente.h"
+
+// Compilar: gcc -O2 -pthread estresse_concorrente.c fila_concorrente.c -o estresse_concorrente
+// Uso: ./estresse_concorrente [threads produtoras (padrão: núcleos)] [itens por produtora (padrão 1000000)]
+// Produtoras e consumidoras trabalham ao mesmo tempo; no fim cada item deve ter saído exatamente uma vez
+
+static FilaConcorrente *fila;
+static atomic_uchar *vistos;
+static atomic_int produtorasAtivas;
+static atomic_long consumidos, repetidos;
+static int itensPorProdutora;
+
+static void *produtora(void *arg) {
+  int primeiro = (int)(size_t)arg * itensPorProdutora;
+  for (int i = 0; i < itensPorProdutora; i++) {
+    int id = primeiro + i;
+    while (!filaConcorrenteInsere(fila, id % 1000, (void *)(intptr_t)id));
+  }
+  atomic_fetch_sub(&produtorasAtivas, 1);
+  return NULL;
+}
+
+static void *consumidora(void *arg) {
+  void *dado;
+  int prioridade;
+  (void)arg;
+  for (;;) {
+    if (filaConcorrenteRemove(fila, &prioridade, &dado)) {
+      int id = (int)(intptr_t)dado;
+      if (prioridade != id % 1000 || atomic_fetch_add(&vistos[id], 1) != 0) atomic_fetch_add(&repetidos, 1);
+      atomic_fetch_add(&consumidos, 1);
+    } else if (atomic_load(&produtorasAtivas) == 0 && filaConcorrenteTamanho(fila) == 0) break;
+  }
+  return NULL;
+}
+
+int main(int argc, char *argv[]) {
+  int threads = (argc > 1) ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+  itensPorProdutora = (argc > 2) ? atoi(argv[2]) : 1000000;
+  if (threads < 1) threads = 1;
+  if (itensPorProdutora < 1) itensPorProdutora = 1000000;
+  long total = (long)threads * itensPorProdutora;
+
+  fila = filaConcorrenteCria(2 * threads);
+  vistos = (atomic_uchar *)calloc(total, sizeof(atomic_uchar));
+  if (fila == NULL || vistos == NULL) {
+    printf("Memória insuficiente\n");
+    return 1;
+  }
+  atomic_init(&produtorasAtivas, threads);
+  pthread_t produtoras[threads], consumidoras[threads];
+  for (int i = 0; i < threads; i++) pthread_create(&produtoras[i], NULL, produtora, (void *)(size_t)i);
+  for (int i = 0; i < threads; i++) pthread_create(&consumidoras[i], NULL, consumidora, NULL);
+  for (int i = 0; i < threads; i++) pthread_join(produtoras[i], NULL);
+  for (int i = 0; i < threads; i++) pthread_join(consumidoras[i], NULL);
+
+  long faltando = 0;
+  for (long i = 0; i < total; i++) faltando += (atomic_load(&vistos[i]) == 0);
+  printf("%d produtoras, %d consumidoras, %ld itens\n", threads, threads, total);
+  printf("consumidos: %ld, repetidos ou corrompidos: %ld, faltando: %ld, restantes na fila: %d\n",
+         atomic_load(&consumidos), atomic_load(&repetidos), faltando, filaConcorrenteTamanho(fila));
+  int ok = atomic_load(&consumidos) == total && atomic_load(&repetidos) == 0 && faltando == 0 && filaConcorrenteTamanho(fila) == 0;
+  printf("%s\n", ok ? "OK" : "FALHOU");
+  fila = filaConcorrenteLibera(fila);
+  free(vistos);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+#include <stdlib.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include "fila_concorrente.h"
+
+#define CAPACIDADE_INICIAL 64
+
+// Valor do topo anunciado por uma fila vazia
+#define TOPO_VAZIO LLONG_MAX
+
+typedef struct {
+  int prioridade;
+  void *dado;
+} Item;
+
+// Fila interna: heap binário de mínimo com trava própria, uma por linha de cache
+typedef struct {
+  _Alignas(64) atomic_flag trava;
+  atomic_llong topo; // Prioridade do topo, lida sem trava p/ escolher a fila na remoção
+  Item *itens;
+  int tam;
+  int capacidade;
+} Fila;
+
+struct FilaConcorrente {
+  Fila *filas; // Alinhadas em 64 bytes dentro de 'bloco'
+  void *bloco;
+  int qtdFilas;
+  atomic_int tam;
+};
+
+// Semente por thread do gerador xorshift
+static _Thread_local unsigned int semente = 0;
+
+static unsigned int sorteia(unsigned int limite) {
+  if (semente == 0) semente = (unsigned int)(uintptr_t)&semente | 1u; // Endereço diferente em cada thread
+  semente ^= semente << 13;
+  semente ^= semente >> 17;
+  semente ^= semente << 5;
+  return semente % limite;
+}
+
+static int tentaTravar(Fila *fila) {
+  return !atomic_flag_test_and_set_explicit(&fila->trava, memory_order_acquire);
+}
+
+static void destrava(Fila *fila) {
+  atomic_store_explicit(&fila->topo, (fila->tam > 0) ? fila->itens[0].prioridade : TOPO_VAZIO, memory_order_relaxed);
+  atomic_flag_clear_explicit(&fila->trava, memory_order_release);
+}
+
+static int heapInsere(Fila *fila, Item item) {
+  if (fila->tam == fila->capacidade) {
+    int capacidade = (fila->capacidade > 0) ? 2 * fila->capacidade : CAPACIDADE_INICIAL;
+    Item *itens = (Item *)realloc(fila->itens, capacidade * sizeof(Item));
+    if (itens == NULL) return 0;
+    fila->itens = itens;
+    fila->capacidade = capacidade;
+  }
+  int i = fila->tam++;
+  while (i > 0 && fila->itens[(i - 1) / 2].prioridade > item.prioridade) {
+    fila->itens[i] = fila->itens[(i - 1) / 2];
+    i = (i - 1) / 2;
+  }
+  fila->itens[i] = item;
+  return 1;
+}
+
+static Item heapRemove(Fila *fila) {
+  Item minimo = fila->itens[0], ultimo = fila->itens[--fila->tam];
+  int i = 0, j;
+  while ((j = 2 * i + 1) < fila->tam) {
+    if (j + 1 < fila->tam && fila->itens[j + 1].prioridade < fila->itens[j].prioridade) j++;
+    if (fila->itens[j].prioridade >= ultimo.prioridade) break;
+    fila->itens[i] = fila->itens[j];
+    i = j;
+  }
+  fila->itens[i] = ultimo;
+  return minimo;
+}
+
+FilaConcorrente *filaConcorrenteCria(int threads) {
+  if (threads < 1) threads = 1;
+  FilaConcorrente *fila = (FilaConcorrente *)malloc(sizeof(FilaConcorrente));
+  if (fila == NULL) return NULL;
+  fila->qtdFilas = threads * FILA_CONCORRENTE_FILAS_POR_THREAD;
+  fila->bloco = malloc(fila->qtdFilas * sizeof(Fila) + 64);
+  if (fila->bloco == NULL) {
+    free(fila);
+    return NULL;
+  }
+  fila->filas = (Fila *)(((uintptr_t)fila->bloco + 63) & ~(uintptr_t)63);
+  for (int i = 0; i < fila->qtdFilas; i++) {
+    atomic_flag_clear(&fila->filas[i].trava);
+    atomic_init(&fila->filas[i].topo, TOPO_VAZIO);
+    fila->filas[i].itens = NULL;
+    fila->filas[i].tam = fila->filas[i].capacidade = 0;
+  }
+  atomic_init(&fila->tam, 0);
+  return fila;
+}
+
+FilaConcorrente *filaConcorrenteLibera(FilaConcorrente *fila) {
+  if (fila == NULL) return NULL;
+  for (int i = 0; i < fila->qtdFilas; i++) free(fila->filas[i].itens);
+  free(fila->bloco);
+  free(fila);
+  return NULL;
+}
+
+int filaConcorrenteInsere(FilaConcorrente *fila, int prioridade, void *dado) {
+  Fila *escolhida;
+  do escolhida = &fila->filas[sorteia(fila->qtdFilas)]; // Fila ocupada: sorteia outra em vez de esperar
+  while (!tentaTravar(escolhida));
+  Item item = {prioridade, dado};
+  int inseriu = heapInsere(escolhida, item);
+  destrava(escolhida);
+  if (inseriu) atomic_fetch_add_explicit(&fila->tam, 1, memory_order_relaxed);
+  return inseriu;
+}
+
+int filaConcorrenteRemove(FilaConcorrente *fila, int *prioridade, void **dado) {
+  Fila *escolhida = NULL;
+  for (int tentativa = 0; tentativa < fila->qtdFilas && escolhida == NULL; tentativa++) { // Duas escolhas ao acaso
+    Fila *a = &fila->filas[sorteia(fila->qtdFilas)], *b = &fila->filas[sorteia(fila->qtdFilas)];
+    long long topoA = atomic_load_explicit(&a->topo, memory_order_relaxed);
+    long long topoB = atomic_load_explicit(&b->topo, memory_order_relaxed);
+    if (topoB < topoA) {
+      a = b;
+      topoA = topoB;
+    }
+    if (topoA == TOPO_VAZIO || !tentaTravar(a)) continue;
+    if (a->tam > 0) escolhida = a;
+    else destrava(a);
+  }
+  for (int i = 0; escolhida == NULL && i < fila->qtdFilas; i++) { // Sorteios sem sucesso: varre todas antes de dizer que está vazia
+    Fila *f = &fila->filas[i];
+    while (!tentaTravar(f));
+    if (f->tam > 0) escolhida = f;
+    else destrava(f);
+  }
+  if (escolhida == NULL) return 0;
+  Item item = heapRemove(escolhida);
+  destrava(escolhida);
+  atomic_fetch_sub_explicit(&fila->tam, 1, memory_order_relaxed);
+  if (prioridade != NULL) *prioridade = item.prioridade;
+  if (dado != NULL) *dado = item.dado;
+  return 1;
+}
+
+int filaConcorrenteTamanho(FilaConcorrente *fila) {
+  return (fila == NULL) ? 0 : atomic_load_explicit(&fila->tam, memory_order_relaxed);
+}
@@ -0,0 +1,28 @@
+#ifndef FILA_CONCORRENTE_H
+#define FILA_CONCORRENTE_H
+
+// Filas internas por thread: mais filas diminuem a disputa e aumentam o relaxamento da ordem
+#define FILA_CONCORRENTE_FILAS_POR_THREAD 2
+
+// Fila de prioridade concorrente relaxada (MultiQueue): várias filas internas com trava própria;
+// a inserção escolhe uma fila ao acaso e a remoção retira o menor entre os topos de duas filas sorteadas.
+// Cada remoção devolve um elemento perto do mínimo global (não necessariamente o mínimo)
+typedef struct FilaConcorrente FilaConcorrente;
+
+// Cria uma fila vazia dimensionada p/ 'threads' threads simultâneas
+FilaConcorrente *filaConcorrenteCria(int threads);
+
+// Libera a fila (nenhuma thread pode estar usando a fila; os dados apontados não são liberados)
+FilaConcorrente *filaConcorrenteLibera(FilaConcorrente *fila);
+
+// Insere um elemento (0 se faltar memória)
+int filaConcorrenteInsere(FilaConcorrente *fila, int prioridade, void *dado);
+
+// Retira um elemento de prioridade baixa (0 se todas as filas internas estiverem vazias);
+// 'prioridade' e 'dado' podem ser NULL
+int filaConcorrenteRemove(FilaConcorrente *fila, int *prioridade, void **dado);
+
+// Quantidade aproximada de elementos (exata quando nenhuma thread está alterando a fila)
+int filaConcorrenteTamanho(FilaConcorrente *fila);
+
+#endif
@@ -0,0 +1,169 @@
+#include <stdlib.h>
+#include "fila_prioridade.h"
+
+// Capacidade inicial da fila
+#define CAPACIDADE_INICIAL 16
+
+// Posição do heap: o dado fica junto da alça p/ que as comparações não precisem de indireção
+typedef struct {
+  void *dado;
+  int alca;
+} Entrada;
+
+struct FilaPrioridade {
+  Entrada *heap;
+  int *posicao; // Posição de cada alça no heap; alças livres guardam -2 - próxima livre
+  int tam;
+  int capacidade;
+  int qtdAlcas; // Alças já distribuídas (em uso ou livres)
+  int livre;    // Primeira alça livre (-1: nenhuma)
+  FilaPrioridadeCompara compara;
+  FilaPrioridadeTipo tipo;
+};
+
+// Verifica se 'a' deve sair antes de 'b'
+static int antes(const FilaPrioridade *fila, const void *a, const void *b) {
+  int comparacao = fila->compara(a, b);
+  return (fila->tipo == FILA_PRIORIDADE_MIN) ? comparacao < 0 : comparacao > 0;
+}
+
+// Sobe a entrada da posição 'i' abrindo um buraco em vez de trocar pares
+static void sobe(FilaPrioridade *fila, int i) {
+  Entrada entrada = fila->heap[i];
+  while (i > 0 && antes(fila, entrada.dado, fila->heap[(i - 1) / 2].dado)) {
+    fila->heap[i] = fila->heap[(i - 1) / 2];
+    fila->posicao[fila->heap[i].alca] = i;
+    i = (i - 1) / 2;
+  }
+  fila->heap[i] = entrada;
+  fila->posicao[entrada.alca] = i;
+}
+
+// Desce a entrada da posição 'i' até os filhos não terem prioridade maior
+static void desce(FilaPrioridade *fila, int i) {
+  Entrada entrada = fila->heap[i];
+  int j;
+  while ((j = 2 * i + 1) < fila->tam) {
+    if (j + 1 < fila->tam && antes(fila, fila->heap[j + 1].dado, fila->heap[j].dado)) j++;
+    if (!antes(fila, fila->heap[j].dado, entrada.dado)) break;
+    fila->heap[i] = fila->heap[j];
+    fila->posicao[fila->heap[i].alca] = i;
+    i = j;
+  }
+  fila->heap[i] = entrada;
+  fila->posicao[entrada.alca] = i;
+}
+
+// Garante espaço p/ mais um elemento dobrando a capacidade
+static int cresce(FilaPrioridade *fila) {
+  if (fila->tam < fila->capacidade) return 1;
+  int capacidade = (fila->capacidade > 0) ? 2 * fila->capacidade : CAPACIDADE_INICIAL;
+  Entrada *heap = (Entrada *)realloc(fila->heap, capacidade * sizeof(Entrada));
+  if (heap == NULL) return 0;
+  fila->heap = heap;
+  int *posicao = (int *)realloc(fila->posicao, capacidade * sizeof(int));
+  if (posicao == NULL) return 0;
+  fila->posicao = posicao;
+  fila->capacidade = capacidade;
+  return 1;
+}
+
+static int alcaValida(const FilaPrioridade *fila, int alca) {
+  return fila != NULL && alca >= 0 && alca < fila->qtdAlcas && fila->posicao[alca] >= 0;
+}
+
+// Retira a entrada da posição 'i' e devolve a sua alça à lista de livres
+static void *retira(FilaPrioridade *fila, int i) {
+  Entrada entrada = fila->heap[i];
+  fila->posicao[entrada.alca] = -2 - fila->livre;
+  fila->livre = entrada.alca;
+  if (i != --fila->tam) { // A última entrada ocupa o lugar e pode precisar subir ou descer
+    int alca = fila->heap[fila->tam].alca;
+    fila->heap[i] = fila->heap[fila->tam];
+    sobe(fila, i);
+    desce(fila, fila->posicao[alca]);
+  }
+  return entrada.dado;
+}
+
+FilaPrioridade *filaPrioridadeCria(FilaPrioridadeCompara compara, FilaPrioridadeTipo tipo) {
+  if (compara == NULL) return NULL;
+  FilaPrioridade *fila = (FilaPrioridade *)malloc(sizeof(FilaPrioridade));
+  if (fila == NULL) return NULL;
+  fila->heap = NULL;
+  fila->posicao = NULL;
+  fila->tam = fila->capacidade = fila->qtdAlcas = 0;
+  fila->livre = -1;
+  fila->compara = compara;
+  fila->tipo = tipo;
+  return fila;
+}
+
+FilaPrioridade *filaPrioridadeConstroi(FilaPrioridadeCompara compara, FilaPrioridadeTipo tipo, void *const *dados, int n) {
+  FilaPrioridade *fila = filaPrioridadeCria(compara, tipo);
+  if (fila == NULL || n <= 0) return fila;
+  fila->heap = (Entrada *)malloc(n * sizeof(Entrada));
+  fila->posicao = (int *)malloc(n * sizeof(int));
+  if (fila->heap == NULL || fila->posicao == NULL) return filaPrioridadeLibera(fila);
+  for (int i = 0; i < n; i++) {
+    fila->heap[i].dado = dados[i];
+    fila->heap[i].alca = fila->posicao[i] = i;
+  }
+  fila->tam = fila->capacidade = fila->qtdAlcas = n;
+  for (int i = n / 2 - 1; i >= 0; i--) desce(fila, i); // Heapify de baixo p/ cima
+  return fila;
+}
+
+FilaPrioridade *filaPrioridadeLibera(FilaPrioridade *fila) {
+  if (fila != NULL) {
+    free(fila->heap);
+    free(fila->posicao);
+    free(fila);
+  }
+  return NULL;
+}
+
+int filaPrioridadeInsere(FilaPrioridade *fila, void *dado) {
+  if (fila == NULL || !cresce(fila)) return -1;
+  int alca = fila->livre;
+  if (alca >= 0) fila->livre = -2 - fila->posicao[alca];
+  else alca = fila->qtdAlcas++;
+  int i = fila->tam++;
+  fila->heap[i].dado = dado;
+  fila->heap[i].alca = alca;
+  sobe(fila, i);
+  return alca;
+}
+
+void *filaPrioridadeTopo(const FilaPrioridade *fila) {
+  return (fila == NULL || fila->tam == 0) ? NULL : fila->heap[0].dado;
+}
+
+void *filaPrioridadeRemove(FilaPrioridade *fila) {
+  return (fila == NULL || fila->tam == 0) ? NULL : retira(fila, 0);
+}
+
+int filaPrioridadeAtualiza(FilaPrioridade *fila, int alca, void *dado) {
+  if (!alcaValida(fila, alca)) return 0;
+  int i = fila->posicao[alca];
+  fila->heap[i].dado = dado;
+  sobe(fila, i);
+  desce(fila, fila->posicao[alca]);
+  return 1;
+}
+
+void *filaPrioridadeRemoveAlca(FilaPrioridade *fila, int alca) {
+  return alcaValida(fila, alca) ? retira(fila, fila->posicao[alca]) : NULL;
+}
+
+void *filaPrioridadeDado(const FilaPrioridade *fila, int alca) {
+  return alcaValida(fila, alca) ? fila->heap[fila->posicao[alca]].dado : NULL;
+}
+
+int filaPrioridadeTamanho(const FilaPrioridade *fila) {
+  return (fila == NULL) ? 0 : fila->tam;
+}
+
+int filaPrioridadeVazia(const FilaPrioridade *fila) {
+  return filaPrioridadeTamanho(fila) == 0;
+}
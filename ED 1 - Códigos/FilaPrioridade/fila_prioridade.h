@@ -0,0 +1,50 @@
+#ifndef FILA_PRIORIDADE_H
+#define FILA_PRIORIDADE_H
+
+// Ordem de retirada da fila
+typedef enum {
+  FILA_PRIORIDADE_MIN, // Retira primeiro o menor elemento
+  FILA_PRIORIDADE_MAX  // Retira primeiro o maior elemento
+} FilaPrioridadeTipo;
+
+// Compara dois elementos (< 0: a vem antes de b, 0: iguais, > 0: a vem depois de b)
+typedef int (*FilaPrioridadeCompara)(const void *a, const void *b);
+
+// Fila de prioridade genérica em heap binário com capacidade dinâmica
+// Os elementos são ponteiros do usuário; a fila não copia nem libera os dados apontados
+typedef struct FilaPrioridade FilaPrioridade;
+
+// Cria uma fila vazia
+FilaPrioridade *filaPrioridadeCria(FilaPrioridadeCompara compara, FilaPrioridadeTipo tipo);
+
+// Cria uma fila com os 'n' elementos do vetor em O(n); o elemento dados[i] recebe a alça i
+FilaPrioridade *filaPrioridadeConstroi(FilaPrioridadeCompara compara, FilaPrioridadeTipo tipo, void *const *dados, int n);
+
+// Libera a fila (os dados apontados não são liberados)
+FilaPrioridade *filaPrioridadeLibera(FilaPrioridade *fila);
+
+// Insere um elemento e retorna a sua alça (-1 se faltar memória)
+int filaPrioridadeInsere(FilaPrioridade *fila, void *dado);
+
+// Consulta o elemento prioritário (NULL se a fila estiver vazia)
+void *filaPrioridadeTopo(const FilaPrioridade *fila);
+
+// Retira e retorna o elemento prioritário (NULL se a fila estiver vazia)
+void *filaPrioridadeRemove(FilaPrioridade *fila);
+
+// Troca o elemento da alça e o reposiciona, servindo também como 'decrease-key' (0: alça inválida)
+int filaPrioridadeAtualiza(FilaPrioridade *fila, int alca, void *dado);
+
+// Retira e retorna o elemento da alça (NULL se a alça for inválida)
+void *filaPrioridadeRemoveAlca(FilaPrioridade *fila, int alca);
+
+// Consulta o elemento da alça (NULL se a alça for inválida); a alça pode ser reaproveitada após a remoção
+void *filaPrioridadeDado(const FilaPrioridade *fila, int alca);
+
+// Quantidade de elementos da fila
+int filaPrioridadeTamanho(const FilaPrioridade *fila);
+
+// Verifica se a fila está vazia
+int filaPrioridadeVazia(const FilaPrioridade *fila);
+
+#endif
@@ -0,0 +1,114 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "heap_dario.h"
+
+#define LINHA_CACHE 64
+#define CAPACIDADE_INICIAL 64
+
+// O elemento lógico i fica em dados[i + aridade - 1]: assim os filhos de i (aridade * i + 1 até aridade * i + aridade)
+// começam em um múltiplo da aridade e, com o vetor alinhado, nunca atravessam duas linhas de cache
+struct HeapDario {
+  int *dados;
+  void *bloco; // Endereço devolvido pelo malloc (dados é o primeiro endereço alinhado dentro dele)
+  int aridade;
+  int tam;
+  int capacidade;
+};
+
+static int *alocaAlinhado(size_t qtd, void **bloco) {
+  *bloco = malloc(qtd * sizeof(int) + LINHA_CACHE);
+  if (*bloco == NULL) return NULL;
+  return (int *)(((uintptr_t)*bloco + LINHA_CACHE - 1) & ~(uintptr_t)(LINHA_CACHE - 1));
+}
+
+static int cresce(HeapDario *heap) {
+  if (heap->tam < heap->capacidade) return 1;
+  int capacidade = (heap->capacidade > 0) ? 2 * heap->capacidade : CAPACIDADE_INICIAL;
+  void *bloco;
+  int *dados = alocaAlinhado((size_t)capacidade + heap->aridade - 1, &bloco);
+  if (dados == NULL) return 0;
+  if (heap->dados != NULL) memcpy(dados, heap->dados, ((size_t)heap->tam + heap->aridade - 1) * sizeof(int));
+  free(heap->bloco);
+  heap->dados = dados;
+  heap->bloco = bloco;
+  heap->capacidade = capacidade;
+  return 1;
+}
+
+// A aridade chega como constante nas chamadas abaixo, então o compilador desenrola os laços de cada variante
+static inline void sobe(int *dados, int i, int dado, const int d) {
+  while (i > 0 && dados[(i - 1) / d + d - 1] < dado) {
+    dados[i + d - 1] = dados[(i - 1) / d + d - 1];
+    i = (i - 1) / d;
+  }
+  dados[i + d - 1] = dado;
+}
+
+static inline void desce(int *dados, int tam, int dado, const int d) {
+  int i = 0, primeiro;
+  while ((primeiro = d * i + 1) < tam) {
+    const int *filhos = &dados[primeiro + d - 1];
+    int maior = 0;
+    if (primeiro + d <= tam) { // Todos os filhos existem: varre a linha inteira sem testar o tamanho
+      for (int k = 1; k < d; k++) if (filhos[k] > filhos[maior]) maior = k;
+    } else {
+      for (int k = 1; k < tam - primeiro; k++) if (filhos[k] > filhos[maior]) maior = k;
+    }
+    if (filhos[maior] <= dado) break;
+    dados[i + d - 1] = filhos[maior];
+    i = primeiro + maior;
+  }
+  dados[i + d - 1] = dado;
+}
+
+HeapDario *heapDarioCria(int aridade) {
+  if (aridade != 2 && aridade != 4 && aridade != 8) return NULL;
+  HeapDario *heap = (HeapDario *)malloc(sizeof(HeapDario));
+  if (heap == NULL) return NULL;
+  heap->dados = NULL;
+  heap->bloco = NULL;
+  heap->aridade = aridade;
+  heap->tam = heap->capacidade = 0;
+  return heap;
+}
+
+HeapDario *heapDarioLibera(HeapDario *heap) {
+  if (heap != NULL) {
+    free(heap->bloco);
+    free(heap);
+  }
+  return NULL;
+}
+
+int heapDarioInsere(HeapDario *heap, int dado) {
+  if (heap == NULL || !cresce(heap)) return 0;
+  int i = heap->tam++;
+  switch (heap->aridade) {
+    case 2: sobe(heap->dados, i, dado, 2); break;
+    case 4: sobe(heap->dados, i, dado, 4); break;
+    default: sobe(heap->dados, i, dado, 8);
+  }
+  return 1;
+}
+
+int heapDarioTopo(const HeapDario *heap, int *dado) {
+  if (heap == NULL || heap->tam == 0) return 0;
+  *dado = heap->dados[heap->aridade - 1];
+  return 1;
+}
+
+int heapDarioRemove(HeapDario *heap, int *dado) {
+  if (!heapDarioTopo(heap, dado)) return 0;
+  int tam = --heap->tam, ultimo = heap->dados[tam + heap->aridade - 1];
+  switch (heap->aridade) {
+    case 2: desce(heap->dados, tam, ultimo, 2); break;
+    case 4: desce(heap->dados, tam, ultimo, 4); break;
+    default: desce(heap->dados, tam, ultimo, 8);
+  }
+  return 1;
+}
+
+int heapDarioTamanho(const HeapDario *heap) {
+  return (heap == NULL) ? 0 : heap->tam;
+}
@@ -0,0 +1,27 @@
+#ifndef HEAP_DARIO_H
+#define HEAP_DARIO_H
+
+// Fila de prioridade de inteiros (máximo primeiro) em heap d-ário
+// Os filhos de cada nó ficam juntos e alinhados dentro de uma linha de cache de 64 bytes,
+// então cada nível da descida custa no máximo uma falta de cache
+typedef struct HeapDario HeapDario;
+
+// Cria um heap vazio com 2, 4 ou 8 filhos por nó (NULL p/ outras aridades)
+HeapDario *heapDarioCria(int aridade);
+
+// Libera a memória alocada para o heap
+HeapDario *heapDarioLibera(HeapDario *heap);
+
+// Insere um elemento (0 se faltar memória)
+int heapDarioInsere(HeapDario *heap, int dado);
+
+// Consulta o maior elemento (0 se o heap estiver vazio)
+int heapDarioTopo(const HeapDario *heap, int *dado);
+
+// Retira o maior elemento (0 se o heap estiver vazio)
+int heapDarioRemove(HeapDario *heap, int *dado);
+
+// Quantidade de elementos do heap
+int heapDarioTamanho(const HeapDario *heap);
+
+#endif
@@ -0,0 +1,186 @@
+#include <stdlib.h>
+#include "heap_pareamento.h"
+
+// Nós por bloco do pool
+#define NOS_POR_BLOCO 1024
+
+struct NoPareamento {
+  int chave;
+  void *dado;
+  struct NoPareamento *filho;    // Primeiro filho
+  struct NoPareamento *irmao;    // Próximo irmão
+  struct NoPareamento *anterior; // Irmão anterior ou, no primeiro filho, o pai (NULL na raiz)
+};
+
+typedef struct Bloco {
+  struct Bloco *prox;
+  NoPareamento nos[NOS_POR_BLOCO];
+} Bloco;
+
+struct HeapPareamento {
+  NoPareamento *raiz;
+  int tam;
+  Bloco *blocos;
+  int usados;          // Nós já entregues do bloco mais recente
+  NoPareamento *livres; // Nós devolvidos, encadeados pelo campo 'irmao'
+};
+
+static NoPareamento *noCria(HeapPareamento *heap) {
+  NoPareamento *no = heap->livres;
+  if (no != NULL) {
+    heap->livres = no->irmao;
+    return no;
+  }
+  if (heap->blocos == NULL || heap->usados == NOS_POR_BLOCO) {
+    Bloco *bloco = (Bloco *)malloc(sizeof(Bloco));
+    if (bloco == NULL) return NULL;
+    bloco->prox = heap->blocos;
+    heap->blocos = bloco;
+    heap->usados = 0;
+  }
+  return &heap->blocos->nos[heap->usados++];
+}
+
+static void noLibera(HeapPareamento *heap, NoPareamento *no) {
+  no->irmao = heap->livres;
+  heap->livres = no;
+}
+
+// Une duas árvores: a de maior chave vira o primeiro filho da outra
+static NoPareamento *liga(NoPareamento *a, NoPareamento *b) {
+  if (a == NULL) return b;
+  if (b == NULL) return a;
+  if (b->chave < a->chave) {
+    NoPareamento *aux = a;
+    a = b;
+    b = aux;
+  }
+  b->anterior = a;
+  b->irmao = a->filho;
+  if (a->filho != NULL) a->filho->anterior = b;
+  a->filho = b;
+  a->irmao = a->anterior = NULL;
+  return a;
+}
+
+// Junta a lista de irmãos em duas passadas sem recursão: pares da esquerda p/ a direita, empilhados,
+// e depois a pilha é unida da direita p/ a esquerda
+static NoPareamento *juntaIrmaos(NoPareamento *primeiro) {
+  NoPareamento *pilha = NULL;
+  while (primeiro != NULL) {
+    NoPareamento *a = primeiro, *b = primeiro->irmao;
+    primeiro = (b != NULL) ? b->irmao : NULL;
+    a->irmao = a->anterior = NULL;
+    if (b != NULL) b->irmao = b->anterior = NULL;
+    NoPareamento *par = liga(a, b);
+    par->irmao = pilha;
+    pilha = par;
+  }
+  NoPareamento *raiz = NULL;
+  while (pilha != NULL) {
+    NoPareamento *prox = pilha->irmao;
+    pilha->irmao = NULL;
+    raiz = liga(raiz, pilha);
+    pilha = prox;
+  }
+  return raiz;
+}
+
+HeapPareamento *heapPareamentoCria() {
+  HeapPareamento *heap = (HeapPareamento *)malloc(sizeof(HeapPareamento));
+  if (heap != NULL) {
+    heap->raiz = NULL;
+    heap->tam = heap->usados = 0;
+    heap->blocos = NULL;
+    heap->livres = NULL;
+  }
+  return heap;
+}
+
+HeapPareamento *heapPareamentoLibera(HeapPareamento *heap) {
+  if (heap == NULL) return NULL;
+  while (heap->blocos != NULL) {
+    Bloco *prox = heap->blocos->prox;
+    free(heap->blocos);
+    heap->blocos = prox;
+  }
+  free(heap);
+  return NULL;
+}
+
+NoPareamento *heapPareamentoInsere(HeapPareamento *heap, int chave, void *dado) {
+  if (heap == NULL) return NULL;
+  NoPareamento *no = noCria(heap);
+  if (no == NULL) return NULL;
+  no->chave = chave;
+  no->dado = dado;
+  no->filho = no->irmao = no->anterior = NULL;
+  heap->raiz = liga(heap->raiz, no);
+  heap->tam++;
+  return no;
+}
+
+NoPareamento *heapPareamentoMinimo(const HeapPareamento *heap) {
+  return (heap == NULL) ? NULL : heap->raiz;
+}
+
+int heapPareamentoRemoveMinimo(HeapPareamento *heap, int *chave, void **dado) {
+  if (heap == NULL || heap->raiz == NULL) return 0;
+  NoPareamento *raiz = heap->raiz;
+  if (chave != NULL) *chave = raiz->chave;
+  if (dado != NULL) *dado = raiz->dado;
+  heap->raiz = juntaIrmaos(raiz->filho);
+  heap->tam--;
+  noLibera(heap, raiz);
+  return 1;
+}
+
+int heapPareamentoDiminui(HeapPareamento *heap, NoPareamento *no, int chave) {
+  if (heap == NULL || no == NULL || chave > no->chave) return 0;
+  no->chave = chave;
+  if (no == heap->raiz) return 1;
+  if (no->anterior->filho == no) no->anterior->filho = no->irmao; // Corta a subárvore do nó do seu pai
+  else no->anterior->irmao = no->irmao;
+  if (no->irmao != NULL) no->irmao->anterior = no->anterior;
+  no->irmao = no->anterior = NULL;
+  heap->raiz = liga(heap->raiz, no);
+  return 1;
+}
+
+HeapPareamento *heapPareamentoUne(HeapPareamento *heap, HeapPareamento *outro) {
+  if (heap == NULL) return outro;
+  if (outro == NULL || outro == heap) return heap;
+  heap->raiz = liga(heap->raiz, outro->raiz);
+  heap->tam += outro->tam;
+  if (outro->blocos != NULL) { // Os blocos do outro passam p/ este heap, atrás do bloco em uso
+    Bloco *ultimo = outro->blocos;
+    while (ultimo->prox != NULL) ultimo = ultimo->prox;
+    if (heap->blocos == NULL) {
+      heap->blocos = outro->blocos;
+      heap->usados = outro->usados;
+    } else {
+      ultimo->prox = heap->blocos->prox;
+      heap->blocos->prox = outro->blocos;
+      for (int i = outro->usados; i < NOS_POR_BLOCO; i++) noLibera(heap, &outro->blocos->nos[i]); // Sobras do bloco
+    }
+  }
+  while (outro->livres != NULL) {
+    NoPareamento *prox = outro->livres->irmao;
+    noLibera(heap, outro->livres);
+    outro->livres = prox;
+  }
+  free(outro);
+  return heap;
+}
+
+int heapPareamentoChave(const NoPareamento *no) {
+  return no->chave;
+}
+
+void *heapPareamentoDado(const NoPareamento *no) {
+  return no->dado;
+}
+
+int heapPareamentoTamanho(const HeapPareamento *heap) {
+  return (heap == NULL) ? 0 : heap->tam;
+}
@@ -0,0 +1,39 @@
+#ifndef HEAP_PAREAMENTO_H
+#define HEAP_PAREAMENTO_H
+
+// Heap de pareamento (menor chave primeiro): inserção, união e redução de chave em O(1),
+// remoção do mínimo em O(log n) amortizado; os nós vêm de um pool do próprio heap
+typedef struct HeapPareamento HeapPareamento;
+
+// Alça de um elemento; vale até o elemento ser removido
+typedef struct NoPareamento NoPareamento;
+
+// Cria um heap vazio
+HeapPareamento *heapPareamentoCria();
+
+// Libera o heap e o pool de nós (os dados apontados não são liberados)
+HeapPareamento *heapPareamentoLibera(HeapPareamento *heap);
+
+// Insere um elemento e retorna a sua alça (NULL se faltar memória)
+NoPareamento *heapPareamentoInsere(HeapPareamento *heap, int chave, void *dado);
+
+// Consulta o elemento de menor chave (NULL se o heap estiver vazio)
+NoPareamento *heapPareamentoMinimo(const HeapPareamento *heap);
+
+// Retira o elemento de menor chave (0 se o heap estiver vazio); 'chave' e 'dado' podem ser NULL
+int heapPareamentoRemoveMinimo(HeapPareamento *heap, int *chave, void **dado);
+
+// Diminui a chave de um elemento (0 se a nova chave for maior que a atual)
+int heapPareamentoDiminui(HeapPareamento *heap, NoPareamento *no, int chave);
+
+// Move todos os elementos de 'outro' para 'heap' e libera 'outro'; as alças continuam válidas
+HeapPareamento *heapPareamentoUne(HeapPareamento *heap, HeapPareamento *outro);
+
+// Chave e dado de uma alça
+int heapPareamentoChave(const NoPareamento *no);
+void *heapPareamentoDado(const NoPareamento *no);
+
+// Quantidade de elementos do heap
+int heapPareamentoTamanho(const HeapPareamento *heap);
+
+#endif
@@ -4,6 +4,10 @@
 #include <unistd.h>
 #include <ctype.h>
 #include "funcoes.h"
+#include "../Ordenacao/radix.h"
+
+#define TIM_MIN_GALOPE 7 // Vitórias seguidas de uma run p/ entrar no modo galope
+#define TIM_PILHA 64      // Com os invariantes a pilha tem O(log n) runs; 64 cobre qualquer int
 
 /* Variáveis que armazenam cores de texto */
 const char *C_RSET = "\033[0m";
@@ -16,14 +20,22 @@ const char *C_AMAR = "\033[38;5;220m";
 
 typedef struct no { // Estrutura que armazena os nós da lista
   Info dado;
+  unsigned char deBloco; // 1: o nó está em um bloco e só é liberado junto com ele
   struct no *prox;
   struct no *ant;
 } No;
 
+typedef struct bloco { // Nós alocados de uma só vez (liberados juntos)
+  struct bloco *prox;
+  int qtd;
+  No nos[];
+} Bloco;
+
 typedef struct lista { // Estrutura que armazena a lista
   No *inicio;
   No *fim;
   int tam;
+  Bloco *blocos; // Blocos dos quais a lista é dona
 } Lista;
 
 /* Cria uma nova lista vazia */ 
@@ -33,10 +45,32 @@ Lista *listaCria() {
     Ptd->inicio = NULL;
     Ptd->fim = NULL;
     Ptd->tam = 0;
+    Ptd->blocos = NULL;
   }
   return Ptd;
 }
 
+/* Aloca um bloco de 'qtd' nós para a lista (NULL se faltar memória) */
+static No *criaBloco(Lista *Ptd, int qtd) {
+  Bloco *bloco = (Bloco *)malloc(sizeof(Bloco) + qtd * sizeof(No));
+  if (bloco == NULL) return NULL;
+  bloco->qtd = qtd;
+  for (int i = 0; i < qtd; i++) bloco->nos[i].deBloco = 1;
+  bloco->prox = Ptd->blocos;
+  Ptd->blocos = bloco;
+  return bloco->nos;
+}
+
+/* Passa os blocos de 'origem' para 'destino', junto com os nós que foram religados nele */
+static void transfereBlocos(Lista *destino, Lista *origem) {
+  if (origem->blocos == NULL) return;
+  Bloco *ultimo = origem->blocos;
+  while (ultimo->prox != NULL) ultimo = ultimo->prox;
+  ultimo->prox = destino->blocos;
+  destino->blocos = origem->blocos;
+  origem->blocos = NULL;
+}
+
 /* Tamanho da lista */
 int listaSize(Lista *Ptd) { 
   return Ptd->tam;
@@ -46,6 +80,7 @@ int listaSize(Lista *Ptd) {
 Lista* listaInsereInicio(Lista *Ptd, const Info dado) {
   No *novo = (No *)malloc(sizeof(No));
   if (novo == NULL) return Ptd; 
+  novo->deBloco = 0;
   novo->dado = dado;
   novo->prox = Ptd->inicio;
   novo->ant = NULL;
@@ -60,6 +95,7 @@ Lista* listaInsereInicio(Lista *Ptd, const Info dado) {
 Lista *listaInsereFim(Lista *Ptd, const Info dado) {
   No *novo = (No *)malloc(sizeof(No));
   if (novo == NULL) return Ptd;
+  novo->deBloco = 0;
   novo->dado = dado;
   novo->prox = NULL;
   novo->ant = Ptd->fim;
@@ -80,7 +116,7 @@ Lista *listaRemove(Lista *Ptd, const Info dado) {
       else Ptd->inicio = atual->prox;
       if (atual->prox != NULL) atual->prox->ant = atual->ant;
       else Ptd->fim = atual->ant;
-      free(atual);
+      if (!atual->deBloco) free(atual);
       Ptd->tam--;
       return Ptd;
     }
@@ -96,10 +132,16 @@ Lista *listaLibera(Lista *Ptd) {
   No *prox;
   while (atual != NULL) { // Libera todos os nós da lista
     prox = atual->prox;
-    free(atual); 
+    if (!atual->deBloco) free(atual); // Os nós dos blocos saem juntos com eles
     atual = prox;
   }
+  while (Ptd->blocos != NULL) {
+    Bloco *bloco = Ptd->blocos;
+    Ptd->blocos = bloco->prox;
+    free(bloco);
+  }
   free(Ptd); 
+  return NULL;
 }
 
 /* Imprime a lista */
@@ -119,128 +161,301 @@ int listaImprime(Lista *Ptd) {
   return 1;
 } 
 
-/* Ordena usando o Insertion Sort */
-void insertionSort(No *inicio, No *fim) {
-  No *i, *j;
-  Info temp;
-  for (i = inicio->prox; i != NULL && i != fim->prox; i = i->prox) {
-    temp = i->dado;
-    j = i;
-    while (j->ant != NULL && j->ant->dado.id > temp.id) {
-      j->dado = j->ant->dado;
-      j = j->ant;
+/* Run natural do Tim Sort: trecho já ordenado e desligado do resto da lista */
+typedef struct {
+  No *inicio;
+  No *fim;
+  int tam;
+} Run;
+
+/* Tamanho mínimo da run: entre 32 e 64, de modo que n / minRun fique perto de uma potência de 2 */
+static int calculaMinRun(int n) {
+  int resto = 0;
+  while (n >= 64) {
+    resto |= n & 1;
+    n >>= 1;
+  }
+  return n + resto;
+}
+
+/* Liga 'no' depois de 'cauda' e devolve o novo fim */
+static No *anexa(No *cauda, No *no) {
+  cauda->prox = no;
+  no->ant = cauda;
+  return no;
+}
+
+/* Ordena usando o Insertion Sort: insere o nó na run reencadeando, procurando do fim p/ o início */
+static void insertionSort(Run *run, No *no) {
+  No *pos = run->fim;
+  while (pos != NULL && pos->dado.id > no->dado.id) pos = pos->ant; // Para no último menor ou igual: mantém a estabilidade
+  if (pos == NULL) { // Menor de todos: vira o início da run
+    no->ant = NULL;
+    no->prox = run->inicio;
+    run->inicio->ant = no;
+    run->inicio = no;
+  } else {
+    no->ant = pos;
+    no->prox = pos->prox;
+    if (pos->prox != NULL) pos->prox->ant = no;
+    else run->fim = no;
+    pos->prox = no;
+  }
+  run->tam++;
+}
+
+/* Separa a próxima run natural a partir de 'inicio' e devolve o resto da lista em 'resto'.
+   Runs estritamente decrescentes são invertidas; runs curtas são completadas até 'minRun' por inserção */
+static Run proximaRun(No *inicio, int minRun, No **resto) {
+  Run run = {inicio, inicio, 1};
+  if (inicio->prox != NULL && inicio->prox->dado.id < inicio->dado.id) { // Decrescente (estrita, p/ não inverter iguais)
+    while (run.fim->prox != NULL && run.fim->prox->dado.id < run.fim->dado.id) {
+      run.fim = run.fim->prox;
+      run.tam++;
     }
-    j->dado = temp;
+    *resto = run.fim->prox;
+    No *atual = inicio, *anterior = NULL;
+    while (anterior != run.fim) { // Inverte a run trocando prox e ant
+      No *prox = atual->prox;
+      atual->prox = anterior;
+      atual->ant = prox;
+      anterior = atual;
+      atual = prox;
+    }
+    run.inicio = run.fim;
+    run.fim = inicio;
+  } else {
+    while (run.fim->prox != NULL && run.fim->prox->dado.id >= run.fim->dado.id) {
+      run.fim = run.fim->prox;
+      run.tam++;
+    }
+    *resto = run.fim->prox;
+  }
+  run.inicio->ant = NULL;
+  run.fim->prox = NULL;
+  while (run.tam < minRun && *resto != NULL) { // Completa a run com os próximos nós
+    No *no = *resto;
+    *resto = no->prox;
+    insertionSort(&run, no);
   }
+  return run;
 }
 
-/* Função para mesclar duas runs */
-No* merge(No *inicio1, No *fim1, No *inicio2, No *fim2) {
-  No dummy;
-  No *tail = &dummy;
-  dummy.prox = NULL;
-  while (inicio1 != NULL && inicio2 != NULL && inicio1 != fim1->prox && inicio2 != fim2->prox) {
-    if (inicio1->dado.id <= inicio2->dado.id) {
-      tail->prox = inicio1;
-      inicio1->ant = tail;
-      tail = tail->prox;
-      inicio1 = inicio1->prox;
-    } else {
-      tail->prox = inicio2;
-      inicio2->ant = tail;
-      tail = tail->prox;
-      inicio2 = inicio2->prox;
+/* Verifica se o nó entra antes da chave: id <= chave, ou id < chave se 'estrito' */
+static int vemAntes(const No *no, int chave, int estrito) {
+  return estrito ? no->dado.id < chave : no->dado.id <= chave;
+}
+
+/* Galope: devolve o último nó do bloco inicial que vem antes da chave (NULL se vazio) e o tamanho em 'qtd'.
+   Em lista cada salto de uma busca exponencial + binária já custa percorrer os nós, e voltar p/ a busca binária
+   percorre o intervalo de novo (medido: 2x mais lento); então o bloco é percorrido uma vez só e religado inteiro */
+static No *galopa(No *inicio, int chave, int estrito, int *qtd) {
+  *qtd = 0;
+  if (!vemAntes(inicio, chave, estrito)) return NULL;
+  No *ultimo = inicio;
+  *qtd = 1;
+  while (ultimo->prox != NULL && vemAntes(ultimo->prox, chave, estrito)) {
+    ultimo = ultimo->prox;
+    (*qtd)++;
+  }
+  return ultimo;
+}
+
+/* Função para mesclar duas runs vizinhas (a antes de b) com modo galope.
+   Depois de 'minGalope' vitórias seguidas de uma das runs, os blocos são encontrados por galope
+   e religados de uma vez; 'minGalope' se adapta conforme o galope compensa ou não */
+static Run merge(Run a, Run b, int *minGalope) {
+  Run res = {a.inicio, b.fim, a.tam + b.tam};
+  if (a.fim->dado.id <= b.inicio->dado.id) { // Já estão em ordem: só emenda
+    a.fim->prox = b.inicio;
+    b.inicio->ant = a.fim;
+    return res;
+  }
+  if (b.fim->dado.id < a.inicio->dado.id) { // Toda a run b vem antes
+    b.fim->prox = a.inicio;
+    a.inicio->ant = b.fim;
+    res.inicio = b.inicio;
+    res.fim = a.fim;
+    return res;
+  }
+  No cabeca;
+  No *cauda = &cabeca, *x = a.inicio, *y = b.inicio;
+  while (x != NULL && y != NULL) {
+    int ganhosA = 0, ganhosB = 0;
+    do { // Modo normal: um nó por vez
+      if (y->dado.id < x->dado.id) {
+        cauda = anexa(cauda, y);
+        y = y->prox;
+        ganhosB++;
+        ganhosA = 0;
+      } else {
+        cauda = anexa(cauda, x);
+        x = x->prox;
+        ganhosA++;
+        ganhosB = 0;
+      }
+    } while (x != NULL && y != NULL && ganhosA < *minGalope && ganhosB < *minGalope);
+    while (x != NULL && y != NULL) { // Modo galope: blocos inteiros de cada run
+      int qtdA, qtdB;
+      No *ultimo = galopa(x, y->dado.id, 0, &qtdA);
+      if (ultimo != NULL) {
+        anexa(cauda, x);
+        cauda = ultimo;
+        x = ultimo->prox;
+        if (x == NULL) break;
+      }
+      cauda = anexa(cauda, y);
+      y = y->prox;
+      if (y == NULL) break;
+      ultimo = galopa(y, x->dado.id, 1, &qtdB);
+      if (ultimo != NULL) {
+        anexa(cauda, y);
+        cauda = ultimo;
+        y = ultimo->prox;
+        if (y == NULL) break;
+      }
+      cauda = anexa(cauda, x);
+      x = x->prox;
+      if (qtdA < TIM_MIN_GALOPE && qtdB < TIM_MIN_GALOPE) { // Galope não compensou: volta ao modo normal
+        (*minGalope)++;
+        break;
+      }
+      if (*minGalope > 1) (*minGalope)--;
     }
   }
-  while (inicio1 != NULL && inicio1 != fim1->prox) {
-    tail->prox = inicio1;
-    inicio1->ant = tail;
-    tail = tail->prox;
-    inicio1 = inicio1->prox;
+  if (x != NULL) { // Emenda o que sobrou de uma das runs
+    anexa(cauda, x);
+    res.fim = a.fim;
+  } else {
+    anexa(cauda, y);
+    res.fim = b.fim;
   }
-  while (inicio2 != NULL && inicio2 != fim2->prox) {
-    tail->prox = inicio2;
-    inicio2->ant = tail;
-    tail = tail->prox;
-    inicio2 = inicio2->prox;
+  res.inicio = cabeca.prox;
+  res.inicio->ant = NULL;
+  return res;
+}
+
+/* Mescla as runs i e i + 1 da pilha */
+static void mesclaNaPilha(Run pilha[], int *qtd, int i, int *minGalope) {
+  pilha[i] = merge(pilha[i], pilha[i + 1], minGalope);
+  if (i + 2 < *qtd) pilha[i + 1] = pilha[i + 2];
+  (*qtd)--;
+}
+
+/* Restaura os invariantes da pilha: |Z| > |Y| + |X| e |Y| > |X| (com a checagem extra de 4 runs) */
+static void equilibraPilha(Run pilha[], int *qtd, int *minGalope) {
+  while (*qtd > 1) {
+    int n = *qtd - 2;
+    if ((n > 0 && pilha[n - 1].tam <= pilha[n].tam + pilha[n + 1].tam) ||
+        (n > 1 && pilha[n - 2].tam <= pilha[n - 1].tam + pilha[n].tam)) {
+      if (pilha[n - 1].tam < pilha[n + 1].tam) n--;
+    } else if (pilha[n].tam > pilha[n + 1].tam) break;
+    mesclaNaPilha(pilha, qtd, n, minGalope);
   }
-  tail->prox = NULL;
-  return dummy.prox;
 }
 
 /* Função principal do Tim Sort */
 Lista* listaTimSort(Lista *Ptd) {
   if (Ptd == NULL || Ptd->inicio == NULL) return Ptd;
-  int minRun = 32; // Tamanho mínimo da run
-  No *inicio = Ptd->inicio;
-  No *fim;
-  No *tempInicio;
-  while (inicio != NULL) { // Ordena por runs usando Insertion Sort
-    tempInicio = inicio;
-    fim = inicio;
-    int count = 1;
-    while (fim->prox != NULL && count < minRun) {
-      fim = fim->prox;
-      count++;
-    }
-    if (fim->prox != NULL) {
-      insertionSort(tempInicio, fim);
-      inicio = fim->prox;
-    } else {
-      insertionSort(tempInicio, fim);
-      break;
-    }
+  Run pilha[TIM_PILHA];
+  int qtd = 0, minGalope = TIM_MIN_GALOPE;
+  int minRun = calculaMinRun(Ptd->tam);
+  No *resto = Ptd->inicio;
+  while (resto != NULL) { // Empilha as runs naturais mantendo os invariantes
+    pilha[qtd++] = proximaRun(resto, minRun, &resto);
+    equilibraPilha(pilha, &qtd, &minGalope);
   }
-  No *leftStart, *leftEnd, *rightStart, *rightEnd;
-  inicio = Ptd->inicio;
-  while (inicio != NULL && inicio->prox != NULL) {
-    leftStart = inicio;
-    leftEnd = inicio;
-    int count = 1;
-    while (leftEnd->prox != NULL && count < minRun) {
-      leftEnd = leftEnd->prox;
-      count++;
+  while (qtd > 1) mesclaNaPilha(pilha, &qtd, qtd - 2, &minGalope); // Mescla o que restou, do topo p/ a base
+  Ptd->inicio = pilha[0].inicio;
+  Ptd->fim = pilha[0].fim;
+  return Ptd;
+}
+
+/* Chave do radix sort: o id do funcionário guardado no nó */
+static uint32_t chaveId(const void *no) {
+  return radixChaveInt(((const No *)no)->dado.id);
+}
+
+/* Ordena a lista por id com radix sort, reencadeando os nós */
+Lista *listaRadixSort(Lista *Ptd) {
+  if (Ptd == NULL || Ptd->tam < 2) return Ptd;
+  No **nos = (No **)malloc(Ptd->tam * sizeof(No *));
+  if (nos == NULL) return Ptd;
+  int i = 0;
+  for (No *atual = Ptd->inicio; atual != NULL; atual = atual->prox) nos[i++] = atual; // Junta os nós em um vetor
+  if (radixOrdenaPonteiros((void **)nos, i, chaveId) == 0) {
+    for (int j = 0; j < i; j++) { // Reencadeia os nós na ordem das chaves
+      nos[j]->ant = (j > 0) ? nos[j - 1] : NULL;
+      nos[j]->prox = (j + 1 < i) ? nos[j + 1] : NULL;
     }
-    if (leftEnd->prox != NULL) {
-      rightStart = leftEnd->prox;
-      rightEnd = rightStart;
-      count = 1;
-      while (rightEnd->prox != NULL && count < minRun) {
-        rightEnd = rightEnd->prox;
-        count++;
-      }
-      inicio = rightEnd->prox;
-      Ptd->inicio = merge(leftStart, leftEnd, rightStart, rightEnd);
-    } else break;
+    Ptd->inicio = nos[0];
+    Ptd->fim = nos[i - 1];
   }
+  free(nos);
   return Ptd;
 }
 
-/* Mescla duas listas */
+/* Mescla duas listas ordenadas por id em uma lista nova; os nós da nova saem de um único bloco */
 Lista *listaMescla(Lista *Ptl1, Lista *Ptl2) {
+  Lista *novaLista = listaCria();
+  if (novaLista == NULL) return NULL;
+  int tam = Ptl1->tam + Ptl2->tam;
+  if (tam == 0) return novaLista;
+  No *nos = criaBloco(novaLista, tam);
+  if (nos == NULL) return listaLibera(novaLista);
   No *n1 = Ptl1->inicio;
   No *n2 = Ptl2->inicio;
-  Lista *novaLista = listaCria();
-  while (n1 != NULL && n2 != NULL) { // Percorre as duas listas
-    if (n1->dado.id < n2->dado.id) { // Insere o menor elemento das listas
-      novaLista = listaInsereFim(novaLista, n1->dado);
+  for (int i = 0; i < tam; i++) { // Copia sempre o menor; no empate a lista 1 vem primeiro
+    if (n2 == NULL || (n1 != NULL && n1->dado.id <= n2->dado.id)) {
+      nos[i].dado = n1->dado;
       n1 = n1->prox;
     } else {
-      novaLista = listaInsereFim(novaLista, n2->dado);
+      nos[i].dado = n2->dado;
       n2 = n2->prox;
     }
+    nos[i].ant = (i > 0) ? &nos[i - 1] : NULL;
+    nos[i].prox = (i + 1 < tam) ? &nos[i + 1] : NULL;
   }
-  while (n1 != NULL) { // Insere os elementos restantes da lista 1
-    novaLista = listaInsereFim(novaLista, n1->dado);
-    n1 = n1->prox;
-  }
-  while (n2 != NULL) { // Insere os elementos restantes da lista 2
-    novaLista = listaInsereFim(novaLista, n2->dado);
-    n2 = n2->prox;
-  }
+  novaLista->inicio = &nos[0];
+  novaLista->fim = &nos[tam - 1];
+  novaLista->tam = tam;
   return novaLista;
 }
 
+/* Mescla a lista 2 na lista 1 religando os nós, sem alocar nada; a lista 2 fica vazia */
+Lista *listaMesclaMove(Lista *Ptl1, Lista *Ptl2) {
+  if (Ptl1 == NULL || Ptl2 == NULL || Ptl1 == Ptl2) return Ptl1;
+  No cabeca;
+  No *cauda = &cabeca;
+  No *n1 = Ptl1->inicio;
+  No *n2 = Ptl2->inicio;
+  while (n1 != NULL && n2 != NULL) { // Religa o menor no fim; no empate a lista 1 vem primeiro
+    No *menor;
+    if (n2->dado.id < n1->dado.id) {
+      menor = n2;
+      n2 = n2->prox;
+    } else {
+      menor = n1;
+      n1 = n1->prox;
+    }
+    cauda->prox = menor;
+    menor->ant = cauda;
+    cauda = menor;
+  }
+  No *resto = (n1 != NULL) ? n1 : n2; // O resto já está encadeado: basta emendar
+  cauda->prox = resto;
+  if (resto != NULL) resto->ant = cauda;
+  if (n1 == NULL) Ptl1->fim = (n2 != NULL) ? Ptl2->fim : cauda;
+  Ptl1->inicio = cabeca.prox;
+  if (Ptl1->inicio != NULL) Ptl1->inicio->ant = NULL;
+  else Ptl1->fim = NULL;
+  Ptl1->tam += Ptl2->tam;
+  transfereBlocos(Ptl1, Ptl2);
+  Ptl2->inicio = Ptl2->fim = NULL;
+  Ptl2->tam = 0;
+  return Ptl1;
+}
+
 /* Limpa o buffer do teclado */
 void limpaBuffer() {
   char c;
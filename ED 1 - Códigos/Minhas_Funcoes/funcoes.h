@@ -42,12 +42,18 @@ Lista *listaLibera(Lista *Ptd);
 /* Imprime a lista */
 int listaImprime(Lista *Ptd); 
 
-/* Função principal do Tim Sort */
+/* Ordena a lista por id com Tim Sort: aproveita as runs já ordenadas da entrada (estável) */
 Lista* listaTimSort(Lista *Ptd);
 
-/* Mescla duas listas */
+/* Ordena a lista por id com radix sort (estável, O(n)) */
+Lista *listaRadixSort(Lista *Ptd);
+
+/* Mescla duas listas ordenadas em uma lista nova, alocando todos os nós de uma vez; as entradas ficam intactas */
 Lista *listaMescla(Lista *list1, Lista *list2);
 
+/* Mescla a lista 2 na lista 1 religando os nós, em O(n) e sem alocar memória; a lista 2 fica vazia */
+Lista *listaMesclaMove(Lista *list1, Lista *list2);
+
 /* Limpa o buffer do teclado */
 void limpaBuffer(); 
 
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include "funcoes.h"
 
+// Compilar: gcc -O2 main_funcoes.c funcoes.c ../Ordenacao/radix.c -o main_funcoes
+
 #define sizeofvet(vet) (sizeof(vet) / sizeof((vet)[0]))
 
 int main() {
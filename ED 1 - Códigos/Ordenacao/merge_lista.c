@@ -0,0 +1,57 @@
+#include "merge_lista.h"
+
+/* Com o esquema de contador binário a pilha i guarda uma lista de 2^i nós; 64 cobre qualquer tamanho */
+#define MERGE_LISTA_NIVEIS 64
+
+#define PROX(no) (*(void **)((char *)(no) + deslocProx))
+#define ANT(no) (*(void **)((char *)(no) + deslocAnt))
+
+/* Intercala duas listas ordenadas (só pelo 'prox'); nos empates 'a' vem primeiro, já que seus nós são os mais antigos */
+static void *intercala(void *a, void *b, size_t deslocProx, ListaCompara compara) {
+  void *inicio = NULL, **cauda = &inicio;
+  while (a != NULL && b != NULL) {
+    if (compara(b, a) < 0) {
+      *cauda = b;
+      cauda = &PROX(b);
+      b = PROX(b);
+    } else {
+      *cauda = a;
+      cauda = &PROX(a);
+      a = PROX(a);
+    }
+  }
+  *cauda = (a != NULL) ? a : b;
+  return inicio;
+}
+
+void *mergeSortLista(void *inicio, size_t deslocProx, size_t deslocAnt, ListaCompara compara, void **fim) {
+  void *niveis[MERGE_LISTA_NIVEIS] = {NULL};
+  int maior = 0;
+  while (inicio != NULL) { // Cada nó entra como lista de 1 e sobe intercalando como um contador binário
+    void *carga = inicio;
+    inicio = PROX(inicio);
+    PROX(carga) = NULL;
+    int i;
+    for (i = 0; niveis[i] != NULL; i++) {
+      carga = intercala(niveis[i], carga, deslocProx, compara);
+      niveis[i] = NULL;
+    }
+    niveis[i] = carga;
+    if (i > maior) maior = i;
+  }
+  void *resultado = NULL;
+  for (int i = 0; i <= maior; i++) { // Junta os níveis restantes: os mais altos têm os nós mais antigos
+    if (niveis[i] != NULL) resultado = intercala(niveis[i], resultado, deslocProx, compara);
+  }
+  void *anterior = NULL;
+  if (deslocAnt != MERGE_LISTA_SEM_ANT) { // Refaz os ponteiros 'ant' em uma passada só
+    for (void *no = resultado; no != NULL; no = PROX(no)) {
+      ANT(no) = anterior;
+      anterior = no;
+    }
+  } else if (fim != NULL) {
+    for (void *no = resultado; no != NULL; no = PROX(no)) anterior = no;
+  }
+  if (fim != NULL) *fim = anterior;
+  return resultado;
+}
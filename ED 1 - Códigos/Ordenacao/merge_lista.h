@@ -0,0 +1,20 @@
+#ifndef MERGE_LISTA_H
+#define MERGE_LISTA_H
+
+#include <stddef.h>
+
+/* Merge sort de baixo p/ cima p/ qualquer lista encadeada: só os ponteiros dos nós são religados,
+   o conteúdo nunca é copiado. Estável: nós iguais para o comparador mantêm a ordem original */
+
+/* Compara dois nós: negativo se 'a' vem antes de 'b', 0 se iguais, positivo se depois */
+typedef int (*ListaCompara)(const void *a, const void *b);
+
+/* Posição do campo 'ant' p/ listas simplesmente encadeadas */
+#define MERGE_LISTA_SEM_ANT ((size_t)-1)
+
+/* Ordena a lista que começa em 'inicio' e devolve o novo início.
+   'deslocProx' e 'deslocAnt' são os offsetof dos ponteiros próximo/anterior no nó (MERGE_LISTA_SEM_ANT se não houver);
+   o último nó é devolvido em 'fim' se ele não for NULL */
+void *mergeSortLista(void *inicio, size_t deslocProx, size_t deslocAnt, ListaCompara compara, void **fim);
+
+#endif
@@ -0,0 +1,111 @@
+#include <stdlib.h>
+#include <string.h>
+#include "radix.h"
+
+#define BITS_DIGITO 8
+#define BALDES (1 << BITS_DIGITO)
+#define PASSADAS (32 / BITS_DIGITO)
+
+/* Ordena as chaves (e os índices, se houver) de forma estável; os histogramas das 4 passadas saem de uma leitura só */
+static int ordenaChaves(uint32_t chaves[], uint32_t indices[], int qtd) {
+  int contagem[PASSADAS][BALDES] = {{0}};
+  for (int i = 0; i < qtd; i++) {
+    uint32_t chave = chaves[i];
+    for (int p = 0; p < PASSADAS; p++) contagem[p][(chave >> (p * BITS_DIGITO)) & (BALDES - 1)]++;
+  }
+  uint32_t *auxChaves = (uint32_t *)malloc(qtd * sizeof(uint32_t));
+  uint32_t *auxIndices = (indices != NULL) ? (uint32_t *)malloc(qtd * sizeof(uint32_t)) : NULL;
+  if (auxChaves == NULL || (indices != NULL && auxIndices == NULL)) {
+    free(auxChaves);
+    free(auxIndices);
+    return -1;
+  }
+  uint32_t *origemChaves = chaves, *destinoChaves = auxChaves;
+  uint32_t *origemIndices = indices, *destinoIndices = auxIndices;
+  for (int p = 0; p < PASSADAS; p++) {
+    int deslocamento = p * BITS_DIGITO, *cont = contagem[p];
+    if (cont[(origemChaves[0] >> deslocamento) & (BALDES - 1)] == qtd) continue; // Todas as chaves têm o mesmo dígito
+    for (int d = 0, soma = 0; d < BALDES; d++) { // Contagem -> posição inicial de cada balde
+      int c = cont[d];
+      cont[d] = soma;
+      soma += c;
+    }
+    for (int i = 0; i < qtd; i++) {
+      int pos = cont[(origemChaves[i] >> deslocamento) & (BALDES - 1)]++;
+      destinoChaves[pos] = origemChaves[i];
+      if (indices != NULL) destinoIndices[pos] = origemIndices[i];
+    }
+    uint32_t *aux = origemChaves;
+    origemChaves = destinoChaves;
+    destinoChaves = aux;
+    aux = origemIndices;
+    origemIndices = destinoIndices;
+    destinoIndices = aux;
+  }
+  if (origemChaves != chaves) { // Número ímpar de passadas feitas: o resultado ficou nos auxiliares
+    memcpy(chaves, origemChaves, qtd * sizeof(uint32_t));
+    if (indices != NULL) memcpy(indices, origemIndices, qtd * sizeof(uint32_t));
+  }
+  free(auxChaves);
+  free(auxIndices);
+  return 0;
+}
+
+int radixOrdenaInteiros(int vetor[], int tamanho) {
+  if (tamanho < 2) return 0;
+  uint32_t *chaves = (uint32_t *)vetor; // Ordena no próprio vetor: inverte o bit de sinal antes e desfaz depois
+  for (int i = 0; i < tamanho; i++) chaves[i] ^= 0x80000000u;
+  int retorno = ordenaChaves(chaves, NULL, tamanho);
+  for (int i = 0; i < tamanho; i++) chaves[i] ^= 0x80000000u;
+  return retorno;
+}
+
+/* Extrai as chaves e numera os registros de 0 a qtd - 1 */
+static int preparaChaves(uint32_t **chaves, uint32_t **indices, int qtd) {
+  *chaves = (uint32_t *)malloc(qtd * sizeof(uint32_t));
+  *indices = (uint32_t *)malloc(qtd * sizeof(uint32_t));
+  if (*chaves == NULL || *indices == NULL) {
+    free(*chaves);
+    free(*indices);
+    return -1;
+  }
+  for (int i = 0; i < qtd; i++) (*indices)[i] = (uint32_t)i;
+  return 0;
+}
+
+int radixOrdenaRegistros(void *registros, int qtd, size_t tamanho, RadixChave chave) {
+  if (qtd < 2) return 0;
+  uint32_t *chaves, *indices;
+  if (preparaChaves(&chaves, &indices, qtd) != 0) return -1;
+  char *base = (char *)registros;
+  for (int i = 0; i < qtd; i++) chaves[i] = chave(base + i * tamanho);
+  char *ordenados = (char *)malloc((size_t)qtd * tamanho);
+  int retorno = -1;
+  if (ordenados != NULL && ordenaChaves(chaves, indices, qtd) == 0) {
+    for (int i = 0; i < qtd; i++) memcpy(ordenados + i * tamanho, base + indices[i] * tamanho, tamanho);
+    memcpy(base, ordenados, (size_t)qtd * tamanho);
+    retorno = 0;
+  }
+  free(ordenados);
+  free(chaves);
+  free(indices);
+  return retorno;
+}
+
+int radixOrdenaPonteiros(void *ponteiros[], int qtd, RadixChave chave) {
+  if (qtd < 2) return 0;
+  uint32_t *chaves, *indices;
+  if (preparaChaves(&chaves, &indices, qtd) != 0) return -1;
+  for (int i = 0; i < qtd; i++) chaves[i] = chave(ponteiros[i]);
+  void **ordenados = (void **)malloc(qtd * sizeof(void *));
+  int retorno = -1;
+  if (ordenados != NULL && ordenaChaves(chaves, indices, qtd) == 0) {
+    for (int i = 0; i < qtd; i++) ordenados[i] = ponteiros[indices[i]];
+    memcpy(ponteiros, ordenados, qtd * sizeof(void *));
+    retorno = 0;
+  }
+  free(ordenados);
+  free(chaves);
+  free(indices);
+  return retorno;
+}
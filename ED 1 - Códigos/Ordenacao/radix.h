@@ -0,0 +1,29 @@
+#ifndef RADIX_H
+#define RADIX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Radix sort LSD estável sobre chaves de 32 bits, em 4 passadas de 8 bits.
+   Passadas em que todas as chaves têm o mesmo dígito são puladas. */
+
+/* Extrai a chave de ordenação de um registro; a ordem é a dos inteiros sem sinal */
+typedef uint32_t (*RadixChave)(const void *registro);
+
+/* Converte um int em chave sem sinal preservando a ordem (inverte o bit de sinal) */
+static inline uint32_t radixChaveInt(int valor) {
+  return (uint32_t)valor ^ 0x80000000u;
+}
+
+/* Ordena um vetor de inteiros (-1 se faltar memória) */
+int radixOrdenaInteiros(int vetor[], int tamanho);
+
+/* Ordena 'qtd' registros de 'tamanho' bytes cada pela chave extraída (-1 se faltar memória).
+   As chaves são extraídas uma vez e ordenadas junto com os índices; os registros só são movidos no fim */
+int radixOrdenaRegistros(void *registros, int qtd, size_t tamanho, RadixChave chave);
+
+/* Ordena um vetor de ponteiros pela chave do registro apontado (-1 se faltar memória).
+   Serve p/ os nós de uma lista encadeada: junta os nós em um vetor, ordena e reencadeia */
+int radixOrdenaPonteiros(void *ponteiros[], int qtd, RadixChave chave);
+
+#endif
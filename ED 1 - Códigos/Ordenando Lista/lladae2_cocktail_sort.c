@@ -1,22 +1,38 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 #include <unistd.h>
 #include <ctype.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include "cores.h"
 #include "utils.h"
 #include "lladae2_cocktail_sort.h"
+#include "../Ordenacao/radix.h"
+#include "../Ordenacao/merge_lista.h"
 
 typedef struct no { // Estrutura que armazena os nós da lista
   int dado;
+  unsigned char deBloco; // 1: o nó está em um bloco e só é liberado junto com ele (ocupa o preenchimento após 'dado')
   struct no *prox;
   struct no *ant;
 } No;
 
+typedef struct bloco { // Nós alocados de uma só vez (liberados juntos)
+  struct bloco *prox;
+  int qtd;
+  No nos[];
+} Bloco;
+
 typedef struct lista { // Estrutura que armazena a lista
   No *inicio;
   No *fim;
   int tam;
+  Bloco *blocos; // Blocos dos quais a lista é dona
 } Lista;
 
 /* Cria uma nova lista vazia */ 
@@ -26,10 +42,32 @@ Lista *listaCria() {
     Ptd->inicio = NULL;
     Ptd->fim = NULL;
     Ptd->tam = 0;
+    Ptd->blocos = NULL;
   }
   return Ptd;
 }
 
+/* Aloca um bloco de 'qtd' nós p/ a lista (NULL se faltar memória) */
+static No *criaBloco(Lista *Ptd, int qtd) {
+  Bloco *bloco = (Bloco *)malloc(sizeof(Bloco) + qtd * sizeof(No));
+  if (bloco == NULL) return NULL;
+  bloco->qtd = qtd;
+  for (int i = 0; i < qtd; i++) bloco->nos[i].deBloco = 1;
+  bloco->prox = Ptd->blocos;
+  Ptd->blocos = bloco;
+  return bloco->nos;
+}
+
+/* Passa os blocos de 'origem' p/ 'destino', junto com os nós que foram religados nele */
+static void transfereBlocos(Lista *destino, Lista *origem) {
+  if (origem->blocos == NULL) return;
+  Bloco *ultimo = origem->blocos;
+  while (ultimo->prox != NULL) ultimo = ultimo->prox;
+  ultimo->prox = destino->blocos;
+  destino->blocos = origem->blocos;
+  origem->blocos = NULL;
+}
+
 /* Tamanho da lista */
 int listaSize(Lista *Ptd) { 
   return Ptd->tam;
@@ -39,6 +77,7 @@ int listaSize(Lista *Ptd) {
 Lista* listaInsereInicio(Lista *Ptd, const int dado) {
   No *novo = (No *)malloc(sizeof(No)); 
   if (novo == NULL) return Ptd; 
+  novo->deBloco = 0;
   novo->dado = dado;
   novo->prox = Ptd->inicio;
   novo->ant = NULL;
@@ -53,6 +92,7 @@ Lista* listaInsereInicio(Lista *Ptd, const int dado) {
 Lista *listaInsereFim(Lista *Ptd, const int dado) {
   No *novo = (No *)malloc(sizeof(No));
   if (novo == NULL) return Ptd;
+  novo->deBloco = 0;
   novo->dado = dado;
   novo->prox = NULL;
   novo->ant = Ptd->fim;
@@ -73,7 +113,7 @@ Lista *listaRemove(Lista *Ptd, const int dado) {
       else Ptd->inicio = atual->prox;
       if (atual->prox != NULL) atual->prox->ant = atual->ant;
       else Ptd->fim = atual->ant;
-      free(atual);
+      if (!atual->deBloco) free(atual);
       Ptd->tam--;
       return Ptd;
     }
@@ -89,10 +129,16 @@ Lista *listaLibera(Lista *Ptd) {
   No *prox;
   while (atual != NULL) { // Libera todos os nós da lista
     prox = atual->prox;
-    free(atual); 
+    if (!atual->deBloco) free(atual); // Os nós dos blocos saem juntos com eles
     atual = prox;
   }
+  while (Ptd->blocos != NULL) {
+    Bloco *bloco = Ptd->blocos;
+    Ptd->blocos = bloco->prox;
+    free(bloco);
+  }
   free(Ptd); 
+  return NULL;
 }
 
 /* Imprime a lista */
@@ -145,28 +191,176 @@ Lista *listaCocktailSort(Lista *Ptd) {
   return Ptd;
 }
 
-/* Mescla duas listas */
+/* Compara os dados de dois nós p/ o merge sort */
+static int comparaNos(const void *a, const void *b) {
+  int x = ((const No *)a)->dado, y = ((const No *)b)->dado;
+  return (x > y) - (x < y);
+}
+
+/* Ordena a lista com merge sort de baixo p/ cima, religando os nós em O(n log n) */
+Lista *listaMergeSort(Lista *Ptd) {
+  if (Ptd == NULL || Ptd->inicio == NULL) return Ptd;
+  void *fim;
+  Ptd->inicio = (No *)mergeSortLista(Ptd->inicio, offsetof(No, prox), offsetof(No, ant), comparaNos, &fim);
+  Ptd->fim = (No *)fim;
+  return Ptd;
+}
+
+/* Ordena a lista com radix sort: copia os dados p/ um vetor, ordena e devolve aos nós */
+Lista *listaRadixSort(Lista *Ptd) {
+  if (Ptd == NULL || Ptd->tam < 2) return Ptd;
+  int *vetor = (int *)malloc(Ptd->tam * sizeof(int));
+  if (vetor == NULL) return Ptd;
+  int i = 0;
+  No *atual;
+  for (atual = Ptd->inicio; atual != NULL; atual = atual->prox) vetor[i++] = atual->dado;
+  if (radixOrdenaInteiros(vetor, i) == 0) { // O dado é só um int: trocar os valores sai mais barato que reencadear
+    i = 0;
+    for (atual = Ptd->inicio; atual != NULL; atual = atual->prox) atual->dado = vetor[i++];
+  }
+  free(vetor);
+  return Ptd;
+}
+
+/* Mescla duas listas ordenadas em uma lista nova; os nós da nova saem de um único bloco */
 Lista *listaMescla(Lista *Ptd1, Lista *Ptd2) {
+  Lista *novaLista = listaCria();
+  if (novaLista == NULL) return NULL;
+  int tam = Ptd1->tam + Ptd2->tam;
+  if (tam == 0) return novaLista;
+  No *nos = criaBloco(novaLista, tam);
+  if (nos == NULL) return listaLibera(novaLista);
   No *n1 = Ptd1->inicio;
   No *n2 = Ptd2->inicio;
-  Lista *novaLista = listaCria();
-  while (n1 != NULL && n2 != NULL) { // Percorre as duas listas
-    if (n1->dado < n2->dado) { // Insere o menor elemento das listas
-      novaLista = listaInsereFim(novaLista, n1->dado);
+  for (int i = 0; i < tam; i++) { // Copia sempre o menor; no empate a lista 1 vem primeiro
+    if (n2 == NULL || (n1 != NULL && n1->dado <= n2->dado)) {
+      nos[i].dado = n1->dado;
       n1 = n1->prox;
     } else {
-      novaLista = listaInsereFim(novaLista, n2->dado);
+      nos[i].dado = n2->dado;
       n2 = n2->prox;
     }
+    nos[i].ant = (i > 0) ? &nos[i - 1] : NULL;
+    nos[i].prox = (i + 1 < tam) ? &nos[i + 1] : NULL;
+  }
+  novaLista->inicio = &nos[0];
+  novaLista->fim = &nos[tam - 1];
+  novaLista->tam = tam;
+  return novaLista;
+}
+
+/* Mescla a lista 2 na lista 1 religando os nós, sem alocar nada; a lista 2 fica vazia */
+Lista *listaMesclaMove(Lista *Ptd1, Lista *Ptd2) {
+  if (Ptd1 == NULL || Ptd2 == NULL || Ptd1 == Ptd2) return Ptd1;
+  No cabeca;
+  No *cauda = &cabeca;
+  No *n1 = Ptd1->inicio;
+  No *n2 = Ptd2->inicio;
+  while (n1 != NULL && n2 != NULL) { // Religa o menor no fim; no empate a lista 1 vem primeiro
+    No *menor;
+    if (n2->dado < n1->dado) {
+      menor = n2;
+      n2 = n2->prox;
+    } else {
+      menor = n1;
+      n1 = n1->prox;
+    }
+    cauda->prox = menor;
+    menor->ant = cauda;
+    cauda = menor;
+  }
+  No *resto = (n1 != NULL) ? n1 : n2; // O resto já está encadeado: basta emendar
+  cauda->prox = resto;
+  if (resto != NULL) resto->ant = cauda;
+  if (n1 == NULL) Ptd1->fim = (n2 != NULL) ? Ptd2->fim : cauda;
+  Ptd1->inicio = cabeca.prox;
+  if (Ptd1->inicio != NULL) Ptd1->inicio->ant = NULL;
+  else Ptd1->fim = NULL;
+  Ptd1->tam += Ptd2->tam;
+  transfereBlocos(Ptd1, Ptd2);
+  Ptd2->inicio = Ptd2->fim = NULL;
+  Ptd2->tam = 0;
+  return Ptd1;
+}
+
+/* Verifica se a lista 'a' vence a 'b' na árvore de perdedores: menor dado primeiro,
+   lista esgotada perde sempre e o empate fica com o menor índice (estável) */
+static int venceArvore(No *atual[], int a, int b) {
+  if (atual[b] == NULL) return 1;
+  if (atual[a] == NULL) return 0;
+  if (atual[a]->dado != atual[b]->dado) return atual[a]->dado < atual[b]->dado;
+  return a < b;
+}
+
+/* Monta a árvore de perdedores: folhas em k..2k-1, cada nó interno guarda o perdedor e o vencedor sobe */
+static int montaArvore(int arvore[], No *atual[], int k, int pos) {
+  if (pos >= k) return pos - k;
+  int esq = montaArvore(arvore, atual, k, 2 * pos), dir = montaArvore(arvore, atual, k, 2 * pos + 1);
+  if (venceArvore(atual, esq, dir)) {
+    arvore[pos] = dir;
+    return esq;
   }
-  while (n1 != NULL) { // Insere os elementos restantes da lista 1
-    novaLista = listaInsereFim(novaLista, n1->dado);
-    n1 = n1->prox;
+  arvore[pos] = esq;
+  return dir;
+}
+
+/* Mescla k listas ordenadas em uma passada com árvore de perdedores (O(N log k)).
+   Com 'move' os nós são religados na lista nova e as listas de entrada ficam vazias;
+   sem 'move' as entradas ficam intactas e os dados são copiados */
+Lista *listaMesclaK(Lista *listas[], int k, int move) {
+  if (listas == NULL || k <= 0) return NULL;
+  Lista *novaLista = listaCria();
+  int *arvore = (int *)malloc(k * sizeof(int));
+  No **atual = (No **)malloc(k * sizeof(No *));
+  if (novaLista == NULL || arvore == NULL || atual == NULL) {
+    free(novaLista);
+    free(arvore);
+    free(atual);
+    return NULL;
   }
-  while (n2 != NULL) { // Insere os elementos restantes da lista 2
-    novaLista = listaInsereFim(novaLista, n2->dado);
-    n2 = n2->prox;
+  int total = 0;
+  for (int i = 0; i < k; i++) {
+    atual[i] = (listas[i] != NULL) ? listas[i]->inicio : NULL;
+    total += (listas[i] != NULL) ? listas[i]->tam : 0;
   }
+  No *nos = NULL;
+  if (!move && total > 0 && (nos = criaBloco(novaLista, total)) == NULL) { // Sem 'move' os nós novos saem de um único bloco
+    free(arvore);
+    free(atual);
+    return listaLibera(novaLista);
+  }
+  int vencedor = montaArvore(arvore, atual, k, 1);
+  while (atual[vencedor] != NULL) { // Retira o menor e refaz só o caminho da folha dele até a raiz
+    No *no = atual[vencedor];
+    atual[vencedor] = no->prox;
+    if (!move) { // Copia o dado p/ o próximo nó do bloco
+      nos[novaLista->tam].dado = no->dado;
+      no = &nos[novaLista->tam];
+    }
+    no->ant = novaLista->fim; // Liga o nó no fim da lista nova
+    no->prox = NULL;
+    if (novaLista->fim != NULL) novaLista->fim->prox = no;
+    else novaLista->inicio = no;
+    novaLista->fim = no;
+    novaLista->tam++;
+    for (int pos = (vencedor + k) / 2; pos >= 1; pos /= 2) { // Disputa com os perdedores guardados no caminho
+      if (venceArvore(atual, arvore[pos], vencedor)) {
+        int aux = arvore[pos];
+        arvore[pos] = vencedor;
+        vencedor = aux;
+      }
+    }
+  }
+  if (move) { // As entradas perderam os nós (e os blocos deles)
+    for (int i = 0; i < k; i++) {
+      if (listas[i] == NULL) continue;
+      transfereBlocos(novaLista, listas[i]);
+      listas[i]->inicio = listas[i]->fim = NULL;
+      listas[i]->tam = 0;
+    }
+  }
+  free(arvore);
+  free(atual);
   return novaLista;
 }
 
@@ -227,29 +421,124 @@ int intervalo(const char *msg, int min, int max) {
   }
 } 
 
+/* Deixa o conteúdo do arquivo acessível em memória: mmap no Unix, leitura única no Windows (-1 se falhar) */
+static int arquivoMapeia(const char *nome_arqv, const char **dados, size_t *tam) {
+  *dados = NULL;
+  *tam = 0;
+#ifdef _WIN32
+  FILE *arquivo = fopen(nome_arqv, "rb");
+  if (arquivo == NULL) return -1;
+  fseek(arquivo, 0, SEEK_END);
+  long fim = ftell(arquivo);
+  rewind(arquivo);
+  char *buffer = (fim > 0) ? (char *)malloc(fim) : NULL;
+  if (buffer != NULL) *tam = fread(buffer, 1, fim, arquivo);
+  fclose(arquivo);
+  if (fim > 0 && buffer == NULL) return -1;
+  *dados = buffer;
+#else
+  int fd = open(nome_arqv, O_RDONLY);
+  if (fd < 0) return -1;
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    return -1;
+  }
+  if (info.st_size > 0) { // mmap não aceita tamanho 0: arquivo vazio fica sem dados
+    void *mapa = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapa == MAP_FAILED) {
+      close(fd);
+      return -1;
+    }
+    madvise(mapa, info.st_size, MADV_SEQUENTIAL); // Só uma passada do início ao fim: leitura antecipada agressiva
+    *dados = (const char *)mapa;
+    *tam = info.st_size;
+  }
+  close(fd);
+#endif
+  return 0;
+}
+
+/* Desfaz o 'arquivoMapeia' */
+static void arquivoDesmapeia(const char *dados, size_t tam) {
+#ifdef _WIN32
+  (void)tam;
+  free((char *)dados);
+#else
+  if (dados != NULL) munmap((void *)dados, tam);
+#endif
+}
+
+/* Converte os nºs do texto (separados por qualquer coisa que não seja dígito ou '-') direto p/ os nós;
+   devolve quantos foram lidos, no máximo 'qtd' */
+static int converteNumeros(const char *dados, size_t tam, No nos[], int qtd) {
+  int lidos = 0, temDigito = 0, negativo = 0;
+  unsigned int valor = 0;
+  for (size_t i = 0; i < tam && lidos < qtd; i++) {
+    unsigned int digito = (unsigned char)dados[i] - '0';
+    if (digito <= 9) { // Caminho comum: acumula sem outros testes
+      valor = valor * 10 + digito;
+      temDigito = 1;
+    } else if (temDigito) { // Separador depois de um nº: grava o nó
+      nos[lidos++].dado = negativo ? (int)(0u - valor) : (int)valor;
+      valor = 0;
+      temDigito = negativo = 0;
+    } else negativo = (dados[i] == '-');
+  }
+  if (temDigito && lidos < qtd) nos[lidos++].dado = negativo ? (int)(0u - valor) : (int)valor; // Último nº sem separador no fim
+  return lidos;
+}
+
 /* Insere todos os nºs de um arquivo em uma lista */
 Lista *arquivoCarrega(Lista *Ptd, const char *nome_arqv, int qtd) {
-  FILE *arquivo = fopen(nome_arqv, "r");
-  if (arquivo == NULL) { // Verifica se o arquivo foi aberto com sucesso
+  if (Ptd == NULL || qtd <= 0) return Ptd;
+  const char *dados;
+  size_t tam;
+  if (arquivoMapeia(nome_arqv, &dados, &tam) != 0) { // Verifica se o arquivo foi aberto com sucesso
     printf(C_FMT_ERRO("\n[Erro ao abrir o arquivo!]: %s\n"), strerror(errno));
     return Ptd;
   }
-  char *linha = NULL, *campo = NULL;
-  size_t tam = 0;
-  int dado;
-  while ((getline(&linha, &tam, arquivo) != -1) && qtd > 0) { // Lê todas as linhas do arquivo até o final ou até preencher a quantidade de números necessária
-    campo = strtok(linha, ","); // Divide a linha em strings usando ','
-    while (campo != NULL && qtd > 0) { // Insere todos os nºs da linha na lista
-      dado = atoi(campo); // Transforma a string em um inteiro
-      Ptd = (rand() % 2 == 0) ? listaInsereInicio(Ptd, dado) : listaInsereFim(Ptd, dado); // Insere no início ou no fim de forma aleatória
-      campo = strtok(NULL, ","); // Pega a próxima string
-      qtd--;
+  No *nos = criaBloco(Ptd, qtd); // Todos os nós de uma vez
+  if (nos == NULL) {
+    arquivoDesmapeia(dados, tam);
+    return Ptd;
+  }
+  int lidos = converteNumeros(dados, tam, nos, qtd);
+  arquivoDesmapeia(dados, tam);
+  if (lidos == 0) { // Arquivo sem nºs: descarta o bloco recém-criado
+    Bloco *bloco = Ptd->blocos;
+    Ptd->blocos = bloco->prox;
+    free(bloco);
+    return Ptd;
+  }
+  for (int i = lidos; i < qtd; i++) nos[i].dado = nos[i - lidos].dado; // Faltaram nºs: recomeça do início do arquivo sem relê-lo
+  unsigned int sorteio = 0;
+  int bits = 0;
+  for (int i = 0; i < qtd; i++) { // Liga no início ou no fim de forma aleatória, 15 sorteios por chamada de rand()
+    if (bits == 0) {
+      sorteio = (unsigned int)rand();
+      bits = 15;
+    }
+    No *no = &nos[i];
+    if ((sorteio & 1) == 0) { // Início
+      no->ant = NULL;
+      no->prox = Ptd->inicio;
+      if (Ptd->inicio != NULL) Ptd->inicio->ant = no;
+      else Ptd->fim = no;
+      Ptd->inicio = no;
+    } else { // Fim
+      no->prox = NULL;
+      no->ant = Ptd->fim;
+      if (Ptd->fim != NULL) Ptd->fim->prox = no;
+      else Ptd->inicio = no;
+      Ptd->fim = no;
     }
+    sorteio >>= 1;
+    bits--;
   }
-  free(linha);
-  fclose(arquivo); 
-  return (qtd > 0) ? arquivoCarrega(Ptd, nome_arqv, qtd) : Ptd; // Faz uma chamada recursiva se ainda houver nºs p/ serem inseridos
-} 
+  Ptd->tam += qtd;
+  return Ptd;
+}
 
 /* Gera nºs aleatórios e armazena em um arquivo */
 int arquivoAleatoriza(const char *nome_arqv, const int min, const int max, const int qtd) { 
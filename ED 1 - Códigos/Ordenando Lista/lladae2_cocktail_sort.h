@@ -27,9 +27,21 @@ int listaImprime(Lista *Ptd);
 /* Ordena a lista usando o algoritmo Cocktail Sort */
 Lista *listaCocktailSort(Lista *Ptd);
 
-/* Mescla duas listas */
+/* Ordena a lista usando merge sort de baixo p/ cima (O(n log n), estável, só religa os nós) */
+Lista *listaMergeSort(Lista *Ptd);
+
+/* Ordena a lista usando radix sort (O(n)) */
+Lista *listaRadixSort(Lista *Ptd);
+
+/* Mescla duas listas ordenadas em uma lista nova, alocando todos os nós de uma vez; as entradas ficam intactas */
 Lista *listaMescla(Lista *list1, Lista *list2);
 
+/* Mescla a lista 2 na lista 1 religando os nós, em O(n) e sem alocar memória; a lista 2 fica vazia */
+Lista *listaMesclaMove(Lista *list1, Lista *list2);
+
+/* Mescla k listas ordenadas em uma passada (O(N log k)); com 'move' reaproveita os nós e esvazia as entradas */
+Lista *listaMesclaK(Lista *listas[], int k, int move);
+
 /* Insere todos os nºs de um arquivo em uma lista */
 Lista *arquivoCarrega(Lista *Ptd, const char *nome_arqv, int qtd); 
  
@@ -6,6 +6,8 @@
 #include "utils.h"
 #include "lladae2_cocktail_sort.h"
 
+// Compilar: gcc -O2 main.c lladae2_cocktail_sort.c ../Ordenacao/radix.c ../Ordenacao/merge_lista.c -o main
+
 #define sizeofvet(vet) (sizeof(vet) / sizeof((vet)[0]))
 
 int main() {
@@ -32,7 +34,6 @@ int main() {
   for (i = 0; i < qtd_l; i++) { // Inicializa cada uma das listas
    listas[i] = listaCria();
   }
-  mesclada = listaCria(); // Inicializa a lista mesclada
 
   for (i = 0; i < qtd_l; i++) { // Percorre o vetor de listas e carrega as informações da base de dados
     listas[i] = arquivoCarrega(listas[i], nome_arquivos[0], qtd_n);
@@ -49,10 +50,10 @@ int main() {
   } 
   */
 
-  for (i = 0; i < qtd_l; i++) { // Ordena cada uma das listas usando o Cocktail Sort e salva o tempo gasto
+  for (i = 0; i < qtd_l; i++) { // Ordena cada uma das listas usando o merge sort e salva o tempo gasto
     printf("\n%sOrdenando%s a lista%s(%d)%s...\n", C_AZUL, C_RESET, C_MAGENTA, i + 1, C_RESET);
     inicio = clock(); // Pega o tempo inicial
-    listas[i] = listaCocktailSort(listas[i]); // Ordena as listas
+    listas[i] = listaMergeSort(listas[i]); // Ordena as listas
     fim = clock(); // Pega o tempo final
     tempo[i] = (double) (fim - inicio) / CLOCKS_PER_SEC; // Calcula o tempo gasto
   }
@@ -64,10 +65,12 @@ int main() {
   } 
   */
 
+  for (i = 0; i < qtd_l; i++) { // Salva as listas ordenadas em arquivos antes que a mescla leve os nós
+    arquivoSalva(listas[i], nome_arquivos[2]);
+  }
+
   printf("\n%sMesclando%s listas...\n", C_AZUL, C_RESET);
-  for (i = 0; i < qtd_l; i++) { // Mescla todas as listas
-    mesclada = listaMescla(mesclada, listas[i]);
-  } 
+  mesclada = listaMesclaK(listas, qtd_l, 1); // Mescla todas as listas de uma vez, reaproveitando os nós
 
   /*
   printf("\nLista %sresultante%s[Tam.:%d]%s:\n", C_AZUL, C_AMARELO, listaSize(mesclada), C_RESET);
@@ -78,9 +81,6 @@ int main() {
     printf("\nTempo p/ %sordenar%s a lista%s(%d)%s: %s%.4f%s segundos\n", C_AZUL, C_RESET, C_MAGENTA, i + 1, C_RESET, C_AMARELO, tempo[i], C_RESET);
   }
 
-  for (i = 0; i < qtd_l; i++) { // Salva as listas ordenadas em arquivos
-    arquivoSalva(listas[i], nome_arquivos[2]);
-  }
   arquivoSalva(mesclada, nome_arquivos[3]);
 
   for (i = 0; i < qtd_l; i++) { // Libera a memória de todas as listas
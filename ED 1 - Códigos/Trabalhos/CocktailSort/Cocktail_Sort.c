@@ -1,34 +1,7 @@
 #include <stdio.h>
+#include "ordenacao.h"
 
-/* Função para ordenar a lista usando o Cocktail Sort */
-void ordenarCocktailSort(int vetor[], int tamanho) {
-  int trocou, temp;
-  int inicio = 0;
-  int fim = tamanho - 1;
-  do { // Loop principal do algoritmo
-    trocou = 0;
-    for (int i = inicio; i < fim; i++) { // Percorrer da esquerda para a direita
-      if (vetor[i] > vetor[i + 1]) { // Trocar elementos se estiverem na ordem errada
-        temp = vetor[i];
-        vetor[i] = vetor[i + 1];
-        vetor[i + 1] = temp;
-        trocou = 1;
-      }
-    }
-    if (!trocou) break; // Se nenhuma troca foi feita, a lista já está ordenada
-    trocou = 0;
-    fim--;
-    for (int i = fim - 1; i >= inicio; i--) { // Percorrer da direita para a esquerda
-      if (vetor[i] > vetor[i + 1]) { // Trocar elementos se estiverem na ordem errada
-        temp = vetor[i];
-        vetor[i] = vetor[i + 1];
-        vetor[i + 1] = temp;
-        trocou = 1;
-      }
-    }
-    inicio++;
-  } while (trocou);
-}
+// Compilar: gcc -O2 -mavx2 Cocktail_Sort.c ordenacao.c -o Cocktail_Sort (sem -mavx2 a rede usa inserção)
 
 // Função principal
 int main() {
@@ -40,7 +13,7 @@ int main() {
         printf("%d ", vetor[i]);
     }
 
-    ordenarCocktailSort(vetor, tamanho);
+    ordenarInteiros(vetor, tamanho);
 
     printf("\nVetor ordenado: ");
     for (int i = 0; i < tamanho; i++) {
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ordenacao.h"
+
+// Compilar: gcc -O2 -mavx2 benchmark.c ordenacao.c -o benchmark
+// Uso: ./benchmark [expoente máximo p/ vetores grandes (4 a 8, padrão 7)]
+
+// Elementos ordenados por medida: vetores pequenos são ordenados muitas vezes
+#define ELEMENTOS_POR_MEDIDA 20000000
+
+// Gerador xorshift: 'rand()' pode ter apenas 15 bits em algumas plataformas
+static unsigned int semente = 2463534242u;
+static int aleatorio() {
+  semente ^= semente << 13;
+  semente ^= semente >> 17;
+  semente ^= semente << 5;
+  return (int)(semente & 0x7fffffff);
+}
+
+static double agora() {
+  return (double)clock() / CLOCKS_PER_SEC;
+}
+
+static int comparaInt(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+static void ordenaQsort(int vetor[], int tamanho) {
+  qsort(vetor, tamanho, sizeof(int), comparaInt);
+}
+
+static void ordenaRede(int vetor[], int tamanho) {
+  ordenarRedeIntercala(vetor, tamanho);
+}
+
+static void ordenaAdaptativo(int vetor[], int tamanho) {
+  ordenarInteiros(vetor, tamanho);
+}
+
+// 0: aleatório, 1: quase ordenado (1% de trocas entre vizinhos), 2: ordenado
+static void gera(int vetor[], int tamanho, int tipo) {
+  for (int i = 0; i < tamanho; i++) vetor[i] = (tipo == 0) ? aleatorio() : i;
+  if (tipo == 1) {
+    for (int k = 0; k < tamanho / 100 + 1; k++) {
+      int i = aleatorio() % (tamanho - 1), temp = vetor[i];
+      vetor[i] = vetor[i + 1];
+      vetor[i + 1] = temp;
+    }
+  }
+}
+
+// Nanossegundos por elemento
+static double mede(void (*ordena)(int[], int), const int original[], int copia[], int tamanho) {
+  int repeticoes = ELEMENTOS_POR_MEDIDA / tamanho;
+  if (repeticoes < 1) repeticoes = 1;
+  double inicio = agora();
+  for (int r = 0; r < repeticoes; r++) { // A cópia entra na medida: cronometrar cada chamada distorceria os vetores pequenos
+    memcpy(copia, original, tamanho * sizeof(int));
+    ordena(copia, tamanho);
+  }
+  double tempo = agora() - inicio;
+  for (int i = 1; i < tamanho; i++) {
+    if (copia[i - 1] > copia[i]) {
+      printf("ERRO: vetor não ordenado\n");
+      exit(1);
+    }
+  }
+  return tempo * 1e9 / ((double)repeticoes * tamanho);
+}
+
+int main(int argc, char *argv[]) {
+  int maxExp = (argc > 1) ? atoi(argv[1]) : 7;
+  if (maxExp < 4 || maxExp > 8) maxExp = 7;
+  const char *tipos[] = {"aleatório", "quase ordenado", "ordenado"};
+
+  printf("Vetores pequenos aleatórios (ns por elemento): escolha de ORDENACAO_LIMIAR_COCKTAIL\n");
+  printf("%8s | %12s | %12s\n", "tamanho", "cocktail", "rede");
+  for (int tamanho = 4; tamanho <= 256; tamanho += (tamanho < 32) ? 4 : tamanho / 2) {
+    int original[256], copia[256];
+    gera(original, tamanho, 0);
+    printf("%8d | %12.2f | %12.2f\n", tamanho, mede(ordenarCocktailSort, original, copia, tamanho), mede(ordenaRede, original, copia, tamanho));
+  }
+
+  printf("\nVetores grandes (ns por elemento)\n");
+  printf("%10s %-15s | %10s | %10s | %10s\n", "tamanho", "entrada", "qsort", "rede", "adaptativo");
+  for (int e = 4, tamanho = 10000; e <= maxExp; e++, tamanho *= 10) {
+    int *original = (int *)malloc(tamanho * sizeof(int)), *copia = (int *)malloc(tamanho * sizeof(int));
+    if (original == NULL || copia == NULL) break;
+    for (int tipo = 0; tipo < 3; tipo++) {
+      gera(original, tamanho, tipo);
+      printf("%10d %-15s | %10.2f | %10.2f | %10.2f\n", tamanho, tipos[tipo], mede(ordenaQsort, original, copia, tamanho),
+             mede(ordenaRede, original, copia, tamanho), mede(ordenaAdaptativo, original, copia, tamanho));
+    }
+    free(original);
+    free(copia);
+  }
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ordenacao.h"
+#include "ordenacao_paralela.h"
+
+// Compilar: gcc -O2 -mavx2 -pthread benchmark_paralelo.c ordenacao_paralela.c ordenacao.c -o benchmark_paralelo
+// Uso: ./benchmark_paralelo [quantidade de valores (padrão 100000000)]
+
+// Gerador xorshift: 'rand()' pode ter apenas 15 bits em algumas plataformas
+static unsigned int semente = 2463534242u;
+static int aleatorio() {
+  semente ^= semente << 13;
+  semente ^= semente >> 17;
+  semente ^= semente << 5;
+  return (int)(semente & 0x7fffffff);
+}
+
+static double agora() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+  int tamanho = (argc > 1) ? atoi(argv[1]) : 100000000;
+  if (tamanho <= 0) tamanho = 100000000;
+  int nucleos = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if (nucleos < 1) nucleos = 1;
+
+  int *original = (int *)malloc((size_t)tamanho * sizeof(int)), *vetor = (int *)malloc((size_t)tamanho * sizeof(int));
+  if (original == NULL || vetor == NULL) {
+    printf("Memória insuficiente\n");
+    return 1;
+  }
+  for (int i = 0; i < tamanho; i++) original[i] = aleatorio();
+
+  memcpy(vetor, original, (size_t)tamanho * sizeof(int));
+  double inicio = agora();
+  ordenarInteiros(vetor, tamanho);
+  double sequencial = agora() - inicio;
+  printf("%d valores aleatórios, %d núcleos\n", tamanho, nucleos);
+  printf("%8s | %10s | %10s\n", "threads", "tempo (s)", "speedup");
+  printf("%8s | %10.3f | %10.2f\n", "seq", sequencial, 1.0);
+
+  for (int threads = 1; threads <= nucleos; threads = (threads < nucleos && 2 * threads > nucleos) ? nucleos : 2 * threads) {
+    memcpy(vetor, original, (size_t)tamanho * sizeof(int));
+    inicio = agora();
+    if (ordenarParalelo(vetor, tamanho, threads) != 0) {
+      printf("Memória insuficiente\n");
+      return 1;
+    }
+    double tempo = agora() - inicio;
+    for (int i = 1; i < tamanho; i++) {
+      if (vetor[i - 1] > vetor[i]) {
+        printf("ERRO: vetor não ordenado\n");
+        return 1;
+      }
+    }
+    printf("%8d | %10.3f | %10.2f\n", threads, tempo, sequencial / tempo);
+  }
+  free(original);
+  free(vetor);
+  return 0;
+}
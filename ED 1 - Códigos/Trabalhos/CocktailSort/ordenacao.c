@@ -0,0 +1,181 @@
+#include <stdlib.h>
+#include <string.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "ordenacao.h"
+
+/* Tamanho das sequências ordenadas pela rede: cada bloco de 64 vira 8 sequências de 8 */
+#define SEQUENCIA 8
+#define BLOCO_REDE (SEQUENCIA * SEQUENCIA)
+
+/* Função para ordenar a lista usando o Cocktail Sort */
+void ordenarCocktailSort(int vetor[], int tamanho) {
+  int trocou, temp;
+  int inicio = 0;
+  int fim = tamanho - 1;
+  do { // Loop principal do algoritmo
+    trocou = 0;
+    for (int i = inicio; i < fim; i++) { // Percorrer da esquerda para a direita
+      if (vetor[i] > vetor[i + 1]) { // Trocar elementos se estiverem na ordem errada
+        temp = vetor[i];
+        vetor[i] = vetor[i + 1];
+        vetor[i + 1] = temp;
+        trocou = 1;
+      }
+    }
+    if (!trocou) break; // Se nenhuma troca foi feita, a lista já está ordenada
+    trocou = 0;
+    fim--;
+    for (int i = fim - 1; i >= inicio; i--) { // Percorrer da direita para a esquerda
+      if (vetor[i] > vetor[i + 1]) { // Trocar elementos se estiverem na ordem errada
+        temp = vetor[i];
+        vetor[i] = vetor[i + 1];
+        vetor[i + 1] = temp;
+        trocou = 1;
+      }
+    }
+    inicio++;
+  } while (trocou);
+}
+
+/* Cocktail Sort com limite de passadas: detecta em O(n) os vetores já ordenados ou quase */
+int ordenarCocktailSortLimitado(int vetor[], int tamanho, int passadas) {
+  int trocou, temp;
+  int inicio = 0;
+  int fim = tamanho - 1;
+  for (int p = 0; p < passadas && inicio < fim; p++) {
+    trocou = 0;
+    for (int i = inicio; i < fim; i++) {
+      if (vetor[i] > vetor[i + 1]) {
+        temp = vetor[i];
+        vetor[i] = vetor[i + 1];
+        vetor[i + 1] = temp;
+        trocou = 1;
+      }
+    }
+    if (!trocou) return 1;
+    trocou = 0;
+    fim--;
+    for (int i = fim - 1; i >= inicio; i--) {
+      if (vetor[i] > vetor[i + 1]) {
+        temp = vetor[i];
+        vetor[i] = vetor[i + 1];
+        vetor[i + 1] = temp;
+        trocou = 1;
+      }
+    }
+    inicio++;
+    if (!trocou) return 1;
+  }
+  return inicio >= fim;
+}
+
+/* Ordenação por inserção, usada nas sobras que não completam um bloco da rede */
+static void ordenaInsercao(int vetor[], int tamanho) {
+  for (int i = 1; i < tamanho; i++) {
+    int valor = vetor[i], j = i - 1;
+    while (j >= 0 && vetor[j] > valor) {
+      vetor[j + 1] = vetor[j];
+      j--;
+    }
+    vetor[j + 1] = valor;
+  }
+}
+
+#ifdef __AVX2__
+#define TROCA(a, b) { __m256i menor = _mm256_min_epi32(a, b); b = _mm256_max_epi32(a, b); a = menor; }
+
+/* Ordena as 8 colunas de um bloco 8x8 com a rede ótima de 19 comparadores e transpõe,
+   deixando 8 sequências ordenadas de 8 elementos */
+static void ordenaBloco(int vetor[]) {
+  __m256i r0 = _mm256_loadu_si256((const __m256i *)(vetor + 0)), r1 = _mm256_loadu_si256((const __m256i *)(vetor + 8));
+  __m256i r2 = _mm256_loadu_si256((const __m256i *)(vetor + 16)), r3 = _mm256_loadu_si256((const __m256i *)(vetor + 24));
+  __m256i r4 = _mm256_loadu_si256((const __m256i *)(vetor + 32)), r5 = _mm256_loadu_si256((const __m256i *)(vetor + 40));
+  __m256i r6 = _mm256_loadu_si256((const __m256i *)(vetor + 48)), r7 = _mm256_loadu_si256((const __m256i *)(vetor + 56));
+
+  TROCA(r0, r2) TROCA(r1, r3) TROCA(r4, r6) TROCA(r5, r7)
+  TROCA(r0, r4) TROCA(r1, r5) TROCA(r2, r6) TROCA(r3, r7)
+  TROCA(r0, r1) TROCA(r2, r3) TROCA(r4, r5) TROCA(r6, r7)
+  TROCA(r2, r4) TROCA(r3, r5)
+  TROCA(r1, r4) TROCA(r3, r6)
+  TROCA(r1, r2) TROCA(r3, r4) TROCA(r5, r6)
+
+  __m256i t0 = _mm256_unpacklo_epi32(r0, r1), t1 = _mm256_unpackhi_epi32(r0, r1);
+  __m256i t2 = _mm256_unpacklo_epi32(r2, r3), t3 = _mm256_unpackhi_epi32(r2, r3);
+  __m256i t4 = _mm256_unpacklo_epi32(r4, r5), t5 = _mm256_unpackhi_epi32(r4, r5);
+  __m256i t6 = _mm256_unpacklo_epi32(r6, r7), t7 = _mm256_unpackhi_epi32(r6, r7);
+  __m256i u0 = _mm256_unpacklo_epi64(t0, t2), u1 = _mm256_unpackhi_epi64(t0, t2);
+  __m256i u2 = _mm256_unpacklo_epi64(t1, t3), u3 = _mm256_unpackhi_epi64(t1, t3);
+  __m256i u4 = _mm256_unpacklo_epi64(t4, t6), u5 = _mm256_unpackhi_epi64(t4, t6);
+  __m256i u6 = _mm256_unpacklo_epi64(t5, t7), u7 = _mm256_unpackhi_epi64(t5, t7);
+
+  _mm256_storeu_si256((__m256i *)(vetor + 0), _mm256_permute2x128_si256(u0, u4, 0x20));
+  _mm256_storeu_si256((__m256i *)(vetor + 8), _mm256_permute2x128_si256(u1, u5, 0x20));
+  _mm256_storeu_si256((__m256i *)(vetor + 16), _mm256_permute2x128_si256(u2, u6, 0x20));
+  _mm256_storeu_si256((__m256i *)(vetor + 24), _mm256_permute2x128_si256(u3, u7, 0x20));
+  _mm256_storeu_si256((__m256i *)(vetor + 32), _mm256_permute2x128_si256(u0, u4, 0x31));
+  _mm256_storeu_si256((__m256i *)(vetor + 40), _mm256_permute2x128_si256(u1, u5, 0x31));
+  _mm256_storeu_si256((__m256i *)(vetor + 48), _mm256_permute2x128_si256(u2, u6, 0x31));
+  _mm256_storeu_si256((__m256i *)(vetor + 56), _mm256_permute2x128_si256(u3, u7, 0x31));
+}
+#else
+/* Sem AVX2: cada sequência de 8 do bloco é ordenada por inserção */
+static void ordenaBloco(int vetor[]) {
+  for (int i = 0; i < BLOCO_REDE; i += SEQUENCIA) ordenaInsercao(vetor + i, SEQUENCIA);
+}
+#endif
+
+void intercalarInteiros(const int a[], int tamA, const int b[], int tamB, int saida[]) {
+  if (tamA == 0 || tamB == 0 || a[tamA - 1] <= b[0]) { // Já estão em ordem: só copia
+    memcpy(saida, a, tamA * sizeof(int));
+    memcpy(saida + tamA, b, tamB * sizeof(int));
+    return;
+  }
+  int i = 0, j = 0, k = 0;
+  while (i < tamA && j < tamB) {
+    int pegaB = b[j] < a[i];
+    saida[k++] = pegaB ? b[j] : a[i];
+    j += pegaB;
+    i += !pegaB;
+  }
+  while (i < tamA) saida[k++] = a[i++];
+  while (j < tamB) saida[k++] = b[j++];
+}
+
+int ordenarRedeIntercala(int vetor[], int tamanho) {
+  if (tamanho < 2) return 0;
+  int *auxiliar = (int *)malloc(tamanho * sizeof(int));
+  if (auxiliar == NULL) return -1;
+
+  int i = 0;
+  for (; i + BLOCO_REDE <= tamanho; i += BLOCO_REDE) ordenaBloco(vetor + i);
+  for (; i < tamanho; i += SEQUENCIA) ordenaInsercao(vetor + i, (tamanho - i < SEQUENCIA) ? tamanho - i : SEQUENCIA);
+
+  int *origem = vetor, *destino = auxiliar;
+  for (int largura = SEQUENCIA; largura < tamanho; largura *= 2) { // Intercalação de baixo p/ cima alternando os vetores
+    for (int inicio = 0; inicio < tamanho; inicio += 2 * largura) {
+      int meio = (inicio + largura < tamanho) ? inicio + largura : tamanho;
+      int fim = (inicio + 2 * largura < tamanho) ? inicio + 2 * largura : tamanho;
+      intercalarInteiros(origem + inicio, meio - inicio, origem + meio, fim - meio, destino + inicio);
+    }
+    int *aux = origem;
+    origem = destino;
+    destino = aux;
+  }
+  if (origem != vetor) memcpy(vetor, origem, tamanho * sizeof(int));
+  free(auxiliar);
+  return 0;
+}
+
+int ordenarInteiros(int vetor[], int tamanho) {
+  if (tamanho <= ORDENACAO_LIMIAR_COCKTAIL) {
+    ordenarCocktailSort(vetor, tamanho);
+    return 0;
+  }
+  int descidas = 0, limite = tamanho / ORDENACAO_FRACAO_DESCIDAS;
+  for (int i = 0; i + 1 < tamanho && descidas <= limite; i++) descidas += vetor[i] > vetor[i + 1]; // Varredura barata antes de tentar o Cocktail
+  if (descidas == 0) return 0;
+  if (descidas <= limite && ordenarCocktailSortLimitado(vetor, tamanho, ORDENACAO_PASSADAS_QUASE_ORDENADO)) return 0;
+  return ordenarRedeIntercala(vetor, tamanho);
+}
@@ -0,0 +1,28 @@
+#ifndef ORDENACAO_H
+#define ORDENACAO_H
+
+/* Até este tamanho o Cocktail Sort é usado direto: acima de ~6 elementos aleatórios a rede já vence (medido com benchmark.c) */
+#define ORDENACAO_LIMIAR_COCKTAIL 6
+
+/* O vetor é tratado como quase ordenado se tiver no máximo tamanho / ORDENACAO_FRACAO_DESCIDAS pares fora de ordem */
+#define ORDENACAO_FRACAO_DESCIDAS 32
+
+/* Passadas de Cocktail Sort tentadas antes de desistir de tratar a entrada como quase ordenada */
+#define ORDENACAO_PASSADAS_QUASE_ORDENADO 2
+
+/* Ordena o vetor usando o Cocktail Sort */
+void ordenarCocktailSort(int vetor[], int tamanho);
+
+/* Executa no máximo 'passadas' idas e voltas do Cocktail Sort (1 se o vetor terminou ordenado) */
+int ordenarCocktailSortLimitado(int vetor[], int tamanho, int passadas);
+
+/* Ordena o vetor com rede de ordenação em blocos de 64 (SIMD com AVX2) seguida de intercalação (-1 se faltar memória) */
+int ordenarRedeIntercala(int vetor[], int tamanho);
+
+/* Intercala duas sequências ordenadas em 'saida' sem desvios no laço principal */
+void intercalarInteiros(const int a[], int tamA, const int b[], int tamB, int saida[]);
+
+/* Ponto de entrada único: Cocktail Sort p/ vetores pequenos ou quase ordenados, rede + intercalação p/ o resto */
+int ordenarInteiros(int vetor[], int tamanho);
+
+#endif
@@ -0,0 +1,215 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "ordenacao.h"
+#include "ordenacao_paralela.h"
+
+/* Tarefas pendentes por thread; com a divisão ao meio a profundidade fica bem abaixo disso */
+#define TAREFAS_POR_FILA 256
+
+typedef struct Tarefa {
+  void (*executa)(struct Tarefa *);
+  atomic_int *pendentes; /* Contador da tarefa mãe, decrementado ao terminar */
+  int *origem;
+  int *outro;
+  int tamanho;
+  int noOutro; /* Ordenação: 1 se o resultado deve ficar em 'outro' */
+  const int *a, *b;
+  int tamA, tamB;
+  int *saida;
+} Tarefa;
+
+/* Fila dupla de cada thread: a dona empilha e desempilha no fundo, as outras roubam do topo */
+typedef struct {
+  pthread_mutex_t trava;
+  Tarefa *tarefas[TAREFAS_POR_FILA];
+  int topo;
+  int fundo;
+  char preenchimento[64];
+} FilaTarefas;
+
+typedef struct {
+  FilaTarefas *filas;
+  int qtd;
+  atomic_int terminou;
+  atomic_int falhou; /* Algum caso base ficou sem memória */
+} Pool;
+
+typedef struct {
+  Pool *pool;
+  int indice;
+} Trabalhador;
+
+static _Thread_local Pool *poolAtual = NULL;
+static _Thread_local int indiceAtual = 0;
+static _Thread_local unsigned int semente = 0;
+
+static int empilha(Tarefa *tarefa) {
+  FilaTarefas *fila = &poolAtual->filas[indiceAtual];
+  pthread_mutex_lock(&fila->trava);
+  if (fila->fundo == fila->topo) fila->topo = fila->fundo = 0; // Fila esvaziada pelos roubos: reaproveita o início
+  int cabe = fila->fundo < TAREFAS_POR_FILA;
+  if (cabe) fila->tarefas[fila->fundo++] = tarefa;
+  pthread_mutex_unlock(&fila->trava);
+  return cabe;
+}
+
+/* Pega uma tarefa da própria fila ou, se ela estiver vazia, rouba a mais antiga de outra thread */
+static Tarefa *pegaTarefa() {
+  FilaTarefas *fila = &poolAtual->filas[indiceAtual];
+  Tarefa *tarefa = NULL;
+  pthread_mutex_lock(&fila->trava);
+  if (fila->fundo > fila->topo) tarefa = fila->tarefas[--fila->fundo];
+  if (fila->fundo == fila->topo) fila->topo = fila->fundo = 0;
+  pthread_mutex_unlock(&fila->trava);
+  if (tarefa != NULL || poolAtual->qtd == 1) return tarefa;
+
+  if (semente == 0) semente = 2654435761u * (indiceAtual + 1);
+  semente ^= semente << 13;
+  semente ^= semente >> 17;
+  semente ^= semente << 5;
+  for (int k = 0; k < poolAtual->qtd && tarefa == NULL; k++) {
+    FilaTarefas *vitima = &poolAtual->filas[(semente + k) % poolAtual->qtd];
+    if (vitima == fila) continue;
+    pthread_mutex_lock(&vitima->trava);
+    if (vitima->fundo > vitima->topo) tarefa = vitima->tarefas[vitima->topo++]; // As do topo são as maiores
+    pthread_mutex_unlock(&vitima->trava);
+  }
+  return tarefa;
+}
+
+static void executa(Tarefa *tarefa) {
+  atomic_int *pendentes = tarefa->pendentes;
+  tarefa->executa(tarefa);
+  atomic_fetch_sub_explicit(pendentes, 1, memory_order_release);
+}
+
+/* Lança a tarefa p/ outra thread poder roubar; se a fila estiver cheia, executa na hora */
+static void lanca(Tarefa *tarefa) {
+  if (!empilha(tarefa)) executa(tarefa);
+}
+
+/* Espera as tarefas filhas ajudando com qualquer tarefa disponível em vez de bloquear */
+static void espera(atomic_int *pendentes) {
+  while (atomic_load_explicit(pendentes, memory_order_acquire) > 0) {
+    Tarefa *tarefa = pegaTarefa();
+    if (tarefa != NULL) executa(tarefa);
+    else sched_yield();
+  }
+}
+
+static int buscaInferior(const int vetor[], int tamanho, int valor) {
+  int inicio = 0, fim = tamanho;
+  while (inicio < fim) {
+    int meio = inicio + (fim - inicio) / 2;
+    if (vetor[meio] < valor) inicio = meio + 1;
+    else fim = meio;
+  }
+  return inicio;
+}
+
+/* Intercala dividindo a maior sequência ao meio e a menor pela busca binária do elemento do meio */
+static void intercalaParalelo(Tarefa *tarefa) {
+  const int *a = tarefa->a, *b = tarefa->b;
+  int tamA = tarefa->tamA, tamB = tarefa->tamB;
+  if (tamA + tamB <= ORDENACAO_PARALELA_INTERCALA) {
+    intercalarInteiros(a, tamA, b, tamB, tarefa->saida);
+    return;
+  }
+  if (tamA < tamB) {
+    const int *aux = a;
+    a = b;
+    b = aux;
+    int tam = tamA;
+    tamA = tamB;
+    tamB = tam;
+  }
+  int meioA = tamA / 2, meioB = buscaInferior(b, tamB, a[meioA]);
+  atomic_int pendentes = 1;
+  Tarefa direita = {intercalaParalelo, &pendentes, NULL, NULL, 0, 0, a + meioA, b + meioB, tamA - meioA, tamB - meioB,
+                    tarefa->saida + meioA + meioB};
+  lanca(&direita);
+  Tarefa esquerda = {intercalaParalelo, NULL, NULL, NULL, 0, 0, a, b, meioA, meioB, tarefa->saida};
+  intercalaParalelo(&esquerda);
+  espera(&pendentes);
+}
+
+/* Ordena 'origem'; o resultado fica em 'origem' ou em 'outro' (noOutro), alternando os vetores a cada nível */
+static void ordenaParalelo(Tarefa *tarefa) {
+  int tamanho = tarefa->tamanho;
+  if (tamanho <= ORDENACAO_PARALELA_BASE) { // Caso base: núcleos de Cocktail/rede da ordenação sequencial
+    if (ordenarInteiros(tarefa->origem, tamanho) != 0) atomic_store(&poolAtual->falhou, 1);
+    if (tarefa->noOutro) memcpy(tarefa->outro, tarefa->origem, tamanho * sizeof(int));
+    return;
+  }
+  int meio = tamanho / 2;
+  atomic_int pendentes = 1;
+  Tarefa direita = {ordenaParalelo, &pendentes, tarefa->origem + meio, tarefa->outro + meio, tamanho - meio, !tarefa->noOutro,
+                    NULL, NULL, 0, 0, NULL};
+  lanca(&direita);
+  Tarefa esquerda = {ordenaParalelo, NULL, tarefa->origem, tarefa->outro, meio, !tarefa->noOutro, NULL, NULL, 0, 0, NULL};
+  ordenaParalelo(&esquerda);
+  espera(&pendentes);
+
+  const int *metades = tarefa->noOutro ? tarefa->origem : tarefa->outro; // As metades ficaram no vetor oposto ao do resultado
+  Tarefa intercala = {intercalaParalelo, NULL, NULL, NULL, 0, 0, metades, metades + meio, meio, tamanho - meio,
+                      tarefa->noOutro ? tarefa->outro : tarefa->origem};
+  intercalaParalelo(&intercala);
+}
+
+static void *trabalha(void *arg) {
+  Trabalhador *trabalhador = (Trabalhador *)arg;
+  poolAtual = trabalhador->pool;
+  indiceAtual = trabalhador->indice;
+  while (!atomic_load_explicit(&poolAtual->terminou, memory_order_acquire)) {
+    Tarefa *tarefa = pegaTarefa();
+    if (tarefa != NULL) executa(tarefa);
+    else sched_yield();
+  }
+  return NULL;
+}
+
+int ordenarParalelo(int vetor[], int tamanho, int threads) {
+  if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if (threads <= 0) threads = 1;
+  if (threads == 1 || tamanho <= ORDENACAO_PARALELA_BASE) return ordenarInteiros(vetor, tamanho);
+
+  int *outro = (int *)malloc((size_t)tamanho * sizeof(int));
+  Pool pool;
+  pool.qtd = threads;
+  pool.filas = (FilaTarefas *)malloc(threads * sizeof(FilaTarefas));
+  pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+  Trabalhador *trabalhadores = (Trabalhador *)malloc(threads * sizeof(Trabalhador));
+  int retorno = -1, criadas = 0;
+  if (outro != NULL && pool.filas != NULL && ids != NULL && trabalhadores != NULL) {
+    atomic_init(&pool.terminou, 0);
+    atomic_init(&pool.falhou, 0);
+    for (int i = 0; i < threads; i++) {
+      pthread_mutex_init(&pool.filas[i].trava, NULL);
+      pool.filas[i].topo = pool.filas[i].fundo = 0;
+      trabalhadores[i].pool = &pool;
+      trabalhadores[i].indice = i;
+    }
+    for (criadas = 1; criadas < threads; criadas++) { // A thread que chamou é a trabalhadora 0
+      if (pthread_create(&ids[criadas], NULL, trabalha, &trabalhadores[criadas]) != 0) break;
+    }
+    poolAtual = &pool;
+    indiceAtual = 0;
+    atomic_int pendentes = 1;
+    Tarefa raiz = {ordenaParalelo, &pendentes, vetor, outro, tamanho, 0, NULL, NULL, 0, 0, NULL};
+    executa(&raiz);
+    poolAtual = NULL;
+    atomic_store_explicit(&pool.terminou, 1, memory_order_release);
+    for (int i = 1; i < criadas; i++) pthread_join(ids[i], NULL);
+    for (int i = 0; i < threads; i++) pthread_mutex_destroy(&pool.filas[i].trava);
+    retorno = atomic_load(&pool.falhou) ? -1 : 0;
+  }
+  free(outro);
+  free(pool.filas);
+  free(ids);
+  free(trabalhadores);
+  return retorno;
+}
@@ -0,0 +1,14 @@
+#ifndef ORDENACAO_PARALELA_H
+#define ORDENACAO_PARALELA_H
+
+/* Trechos até este tamanho são ordenados em uma thread só com 'ordenarInteiros' */
+#define ORDENACAO_PARALELA_BASE (1 << 16)
+
+/* Intercalações até este tamanho não são divididas entre threads */
+#define ORDENACAO_PARALELA_INTERCALA (1 << 16)
+
+/* Ordena o vetor com merge sort paralelo sobre um pool de 'threads' threads com roubo de tarefas
+   (0 ou menos: uma por núcleo); retorna -1 se faltar memória ou não for possível criar as threads */
+int ordenarParalelo(int vetor[], int tamanho, int threads);
+
+#endif
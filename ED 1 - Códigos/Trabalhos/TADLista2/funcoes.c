@@ -1,4 +1,6 @@
 #include "lista.h"
+#include "../../Ordenacao/radix.h"
+#include "../../Ordenacao/merge_lista.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -16,12 +18,21 @@ const char *amar = "\033[38;5;220m";
 /* Estrutura para um nó da lista encadeada */
 typedef struct no {
   Transacao trans;
+  unsigned char de_bloco; // 1: o nó está em um bloco e só é liberado junto com ele (ocupa o preenchimento após 'trans')
   struct no *proximo;
 } No;
 
+/* Nós alocados de uma só vez (liberados juntos) */
+typedef struct bloco {
+  struct bloco *proximo;
+  int qtd;
+  No nos[];
+} Bloco;
+
 /* Estrutura para a lista */
 typedef struct lista {
   No *inicio;
+  Bloco *blocos; // Blocos dos quais a lista é dona
 } Lista;
 
 /* Cria a lista */
@@ -29,10 +40,24 @@ Lista *Cria_lista(void) {
   Lista *pt = (Lista *)malloc(sizeof(Lista));
   if (pt != NULL) { // Se a alocação foi bem-sucedida
     pt->inicio = NULL;
+    pt->blocos = NULL;
   }
   return pt;
 }
 
+/* Aloca um bloco de 'qtd' nós para a lista */
+static No *Cria_bloco(Lista *Ptl, int qtd) {
+  Bloco *bloco = (Bloco *)malloc(sizeof(Bloco) + qtd * sizeof(No));
+  if (bloco == NULL) // Verifica se o bloco foi alocado corretamente
+    return NULL;
+  bloco->qtd = qtd;
+  for (int i = 0; i < qtd; i++)
+    bloco->nos[i].de_bloco = 1;
+  bloco->proximo = Ptl->blocos;
+  Ptl->blocos = bloco;
+  return bloco->nos;
+}
+
 /* Libera a lista */
 Lista* Libera_lista(Lista *Ptl) {
   if (Ptl == NULL) // Verifica se a lista é válida
@@ -40,9 +65,15 @@ Lista* Libera_lista(Lista *Ptl) {
   No *atual = Ptl->inicio;
   while (atual != NULL) { // Percorre a lista e libera cada nó
     No *prox = atual->proximo;
-    free(atual);
+    if (!atual->de_bloco) // Os nós dos blocos saem juntos com eles
+      free(atual);
     atual = prox;
   }
+  while (Ptl->blocos != NULL) { // Libera os blocos
+    Bloco *bloco = Ptl->blocos;
+    Ptl->blocos = bloco->proximo;
+    free(bloco);
+  }
   free(Ptl);
   return NULL;
 }
@@ -55,6 +86,7 @@ Lista *Insere_elem(Lista *Ptl, Transacao info) {
   if (novo == NULL) // Verifica se o novo nó foi alocado corretamente
     return Ptl;
   novo->trans = info;
+  novo->de_bloco = 0;
   novo->proximo = NULL;
   if (Ptl->inicio == NULL) { // Se a lista está vazia
     Ptl->inicio = novo;
@@ -84,7 +116,8 @@ Lista *Remove_elem(Lista *Ptl, int valor_ID) {
     Ptl->inicio = atual->proximo;
   else
     anterior->proximo = atual->proximo;
-  free(atual);
+  if (!atual->de_bloco)
+    free(atual);
   return Ptl;
 }
 
@@ -138,60 +171,118 @@ int E_ordenada(Lista *Ptl) {
   return 1;  // Lista está ordenada
 }
 
+/* Compara as transações de dois nós pelo ID */
+static int Compara_nos_id(const void *a, const void *b) {
+  int x = ((const No *)a)->trans.ID, y = ((const No *)b)->trans.ID;
+  return (x > y) - (x < y);
+}
+
+/* Compara as transações de dois nós pela data */
+static int Compara_nos_data(const void *a, const void *b) {
+  return Compara_datas(((const No *)a)->trans.data, ((const No *)b)->trans.data);
+}
+
 /* Ordena a lista por ID */
 Lista* Ordena_lista(Lista *Ptl) { 
   if (Ptl == NULL || Ptl->inicio == NULL) { // Verifica se a lista está vazia ou não
     return Ptl;
   }
+  Ptl->inicio = mergeSortLista(Ptl->inicio, offsetof(No, proximo), MERGE_LISTA_SEM_ANT, Compara_nos_id, NULL); // Religa os nós, sem copiar as transações
+  return Ptl;
+}
+
+/* Chave do radix sort: ID da transação */
+static uint32_t Chave_id(const void *no) {
+  return radixChaveInt(((const No *)no)->trans.ID);
+}
+
+/* Chave do radix sort: data da transação no formato AAAAMMDD */
+static uint32_t Chave_data(const void *no) {
+  Data d = ((const No *)no)->trans.data;
+  return radixChaveInt(d.ano * 10000 + d.mes * 100 + d.dia);
+}
+
+/* Ordena a lista por ID ou por data com radix sort, reencadeando os nós */
+Lista* Ordena_lista_radix(Lista *Ptl, int por_data) {
   int tam = Tamanho_lista(Ptl);
-  for (int i = 0; i < tam - 1; i++) { // Percorre a lista até o penúltimo elemento
-    No *atual = Ptl->inicio;
-    No *proximo = atual->proximo;
-    int trocou = 0; 
-    while (proximo != NULL) { // Percorre a lista até o último elemento
-      if (atual->trans.ID > proximo->trans.ID) { // Verifica se o ID do atual é maior que o do próximo
-        Transacao temp = atual->trans;
-        atual->trans = proximo->trans;
-        proximo->trans = temp;
-        trocou = 1;  // Marca que houve troca
-      }
-      atual = proximo;
-      proximo = proximo->proximo;
-    }
-    if (!trocou) { // Se não houve troca, a lista já está ordenada
-      i = tam - 1; 
-      continue;
-    }
+  if (tam < 2) // Lista inválida, vazia ou com um elemento
+    return Ptl;
+  No **nos = (No **)malloc(tam * sizeof(No *));
+  if (nos == NULL)
+    return Ptl;
+  int i = 0;
+  for (No *atual = Ptl->inicio; atual != NULL; atual = atual->proximo) // Junta os nós em um vetor
+    nos[i++] = atual;
+  if (radixOrdenaPonteiros((void **)nos, tam, por_data ? Chave_data : Chave_id) == 0) { // Estável: mesma data mantém a ordem anterior
+    for (i = 0; i < tam - 1; i++) // Reencadeia os nós na ordem das chaves
+      nos[i]->proximo = nos[i + 1];
+    nos[tam - 1]->proximo = NULL;
+    Ptl->inicio = nos[0];
   }
+  free(nos);
   return Ptl;
 }
 
-/* Função que mescla duas listas */
+/* Função que mescla duas listas: a lista nova tem todos os nós alocados de uma vez */
 Lista* Mescla_listas(Lista* lista1, Lista* lista2) {
   if (lista1 == NULL && lista2 == NULL) { // Verifica se as listas são vazias
     return NULL;
   }
   Lista* lista_mesclada = Cria_lista();
-  No* atual1 = lista1->inicio;
-  No* atual2 = lista2->inicio;
-  while (atual1 != NULL && atual2 != NULL) { // Percorre as listas até o final
-    if (atual1->trans.ID < atual2->trans.ID) { // Verifica qual ID é menor
-      Insere_elem(lista_mesclada, atual1->trans);
+  if (lista_mesclada == NULL)
+    return NULL;
+  int tam = (lista1 != NULL ? Tamanho_lista(lista1) : 0) + (lista2 != NULL ? Tamanho_lista(lista2) : 0);
+  if (tam == 0)
+    return lista_mesclada;
+  No* nos = Cria_bloco(lista_mesclada, tam);
+  if (nos == NULL)
+    return Libera_lista(lista_mesclada);
+  No* atual1 = lista1 != NULL ? lista1->inicio : NULL;
+  No* atual2 = lista2 != NULL ? lista2->inicio : NULL;
+  for (int i = 0; i < tam; i++) { // Copia sempre o menor ID; no empate a lista1 vem primeiro
+    if (atual2 == NULL || (atual1 != NULL && atual1->trans.ID <= atual2->trans.ID)) {
+      nos[i].trans = atual1->trans;
       atual1 = atual1->proximo;
     } else {
-      Insere_elem(lista_mesclada, atual2->trans);
+      nos[i].trans = atual2->trans;
       atual2 = atual2->proximo;
     }
+    nos[i].proximo = (i + 1 < tam) ? &nos[i + 1] : NULL;
   }
-  while (atual1 != NULL) { // Insere os elementos restantes da lista1
-    Insere_elem(lista_mesclada, atual1->trans);
-    atual1 = atual1->proximo;
+  lista_mesclada->inicio = &nos[0];
+  return lista_mesclada;
+}
+
+/* Função que mescla a lista2 na lista1 religando os nós, sem alocar memória; a lista2 fica vazia */
+Lista* Mescla_listas_move(Lista* lista1, Lista* lista2) {
+  if (lista1 == NULL || lista2 == NULL || lista1 == lista2) // Verifica se as listas são válidas
+    return lista1;
+  No cabeca;
+  No* cauda = &cabeca;
+  No* atual1 = lista1->inicio;
+  No* atual2 = lista2->inicio;
+  while (atual1 != NULL && atual2 != NULL) { // Religa o menor ID no fim; no empate a lista1 vem primeiro
+    if (atual2->trans.ID < atual1->trans.ID) {
+      cauda->proximo = atual2;
+      atual2 = atual2->proximo;
+    } else {
+      cauda->proximo = atual1;
+      atual1 = atual1->proximo;
+    }
+    cauda = cauda->proximo;
   }
-  while (atual2 != NULL) { // Insere os elementos restantes da lista2
-    Insere_elem(lista_mesclada, atual2->trans);
-    atual2 = atual2->proximo;
+  cauda->proximo = (atual1 != NULL) ? atual1 : atual2; // O resto já está encadeado: basta emendar
+  lista1->inicio = cabeca.proximo;
+  if (lista2->blocos != NULL) { // Os blocos da lista2 passam para a lista1 junto com os nós
+    Bloco* ultimo = lista2->blocos;
+    while (ultimo->proximo != NULL)
+      ultimo = ultimo->proximo;
+    ultimo->proximo = lista1->blocos;
+    lista1->blocos = lista2->blocos;
+    lista2->blocos = NULL;
   }
-  return lista_mesclada;
+  lista2->inicio = NULL;
+  return lista1;
 }
 
 /* Limpa o buffer do teclado */
@@ -480,23 +571,7 @@ float Calcula_saldo(Lista *Ptl) {
 void Ordena_transacoes_por_data(Lista *Ptl) {
   if (Ptl == NULL || Ptl->inicio == NULL) // Verifica se a lista está vazia ou não
     return;
-  No *atual = Ptl->inicio;
-  No *proximo = NULL;
-  Transacao temp;
-  int trocou; // Variável para verificar se houve troca
-  do {
-    trocou = 0;
-    atual = Ptl->inicio;
-    while (atual->proximo != proximo) { // Percorre a lista até o último elemento
-      if (Compara_datas(atual->trans.data, atual->proximo->trans.data) > 0) { // Verifica se a data do atual é maior que a do próximo
-        temp = atual->trans;
-        atual->trans = atual->proximo->trans;
-        atual->proximo->trans = temp;
-        trocou = 1;
-      }
-      atual = atual->proximo;     
-    }
-  } while (trocou); // Repete o processo até não haver mais trocas
+  Ptl->inicio = mergeSortLista(Ptl->inicio, offsetof(No, proximo), MERGE_LISTA_SEM_ANT, Compara_nos_data, NULL); // Estável: mesma data mantém a ordem anterior
 }
 
 /* Função para exibir o menu e pegar a escolha do usuário */
@@ -52,7 +52,9 @@ int Tamanho_lista(Lista* Ptl); /* Retorna o tamanho da lista */
 int E_vazia(Lista* Ptl); /* Verifica se a lista está vazia */
 int E_ordenada(Lista *Ptl); /* Verifica se a lista está ordenada */
 Lista* Ordena_lista(Lista *Ptl); /* Ordena a lista por ID */
+Lista* Ordena_lista_radix(Lista *Ptl, int por_data); /* Ordena a lista por ID ou por data com radix sort */
 Lista* Mescla_listas(Lista* lista1, Lista* lista2); /* Função que mescla duas listas */
+Lista* Mescla_listas_move(Lista* lista1, Lista* lista2); /* Mescla a lista2 na lista1 religando os nós, sem alocar memória */
 void Limpa_buffer(); /* Limpa o buffer do teclado */
 void Cls_screen(); /* Limpa a tela do terminal */
 void Limpa_tela(); /* Aguarda uma entrada do usuário p/ limpar a tela do terminal */
@@ -160,6 +160,7 @@ int main(void) {
         if (!E_ordenada(trans2)) { // Verifica se a lista não está ordenada
           Ordena_lista(trans2);
         }
+        Libera_lista(trans3); // Descarta a mescla anterior
         trans3 = Mescla_listas(trans1, trans2);
         Exibe_lista(trans3);
       } else { // Se a lista está vazia
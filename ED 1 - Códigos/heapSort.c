@@ -4,9 +4,18 @@
 // Definição da estrutura do nó da lista encadeada
 typedef struct NodeL {
   int info;
+  unsigned char doBloco; // 1: o nó está no bloco da lista e só é liberado junto com ele (ocupa o preenchimento após 'info')
   struct NodeL* prox;
 } NodeL;
 
+// Descritor da lista: guarda o último nó e o tamanho p/ inserir no fim e contar em O(1)
+typedef struct {
+  NodeL* inicio;
+  NodeL* fim;
+  int tam;
+  NodeL* bloco; // Nós criados de uma só vez por 'listaDeVetor' (liberados juntos)
+} Lista;
+
 /**
  * @brief Cria um novo nó com o valor especificado.
  *
@@ -17,28 +26,87 @@ NodeL* criarNo(int valor) {
   NodeL* novoNo = (NodeL*)malloc(sizeof(NodeL));
   if (novoNo != NULL) {
     novoNo->info = valor;
+    novoNo->doBloco = 0;
     novoNo->prox = NULL;
   }
   return novoNo;
 }
 
 /**
- * @brief Adiciona um novo nó ao final da lista.
+ * @brief Cria uma lista vazia.
+ *
+ * @return Um ponteiro para a nova lista ou NULL se faltar memória.
+ */
+Lista* listaCria() {
+  Lista* lista = (Lista*)malloc(sizeof(Lista));
+  if (lista != NULL) {
+    lista->inicio = lista->fim = lista->bloco = NULL;
+    lista->tam = 0;
+  }
+  return lista;
+}
+
+/**
+ * @brief Cria uma lista com os valores do vetor, alocando todos os nós em um único bloco.
  *
- * @param inicio Ponteiro para o ponteiro do primeiro nó da lista.
+ * @param valores O vetor de valores, na ordem em que devem aparecer na lista.
+ * @param n A quantidade de valores.
+ * @return Um ponteiro para a nova lista ou NULL se faltar memória.
+ */
+Lista* listaDeVetor(const int* valores, int n) {
+  Lista* lista = listaCria();
+  if (lista == NULL || n <= 0) return lista;
+  NodeL* bloco = (NodeL*)malloc(n * sizeof(NodeL));
+  if (bloco == NULL) {
+    free(lista);
+    return NULL;
+  }
+  for (int i = 0; i < n; i++) {
+    bloco[i].info = valores[i];
+    bloco[i].doBloco = 1;
+    bloco[i].prox = &bloco[i + 1];
+  }
+  bloco[n - 1].prox = NULL;
+  lista->inicio = lista->bloco = bloco;
+  lista->fim = &bloco[n - 1];
+  lista->tam = n;
+  return lista;
+}
+
+/**
+ * @brief Libera todos os nós e o descritor da lista.
+ *
+ * @param lista A lista que será liberada.
+ * @return NULL.
+ */
+Lista* listaLibera(Lista* lista) {
+  if (lista == NULL) return NULL;
+  NodeL* temp = lista->inicio;
+  while (temp != NULL) {
+    NodeL* prox = temp->prox;
+    if (!temp->doBloco) free(temp); // Os nós do bloco saem juntos
+    temp = prox;
+  }
+  free(lista->bloco);
+  free(lista);
+  return NULL;
+}
+
+/**
+ * @brief Adiciona um novo nó ao final da lista em O(1).
+ *
+ * @param lista A lista que receberá o nó.
  * @param valor O valor a ser adicionado.
+ * @return 0 se o nó for adicionado ou -1 se ocorrer um erro de alocação de memória.
  */
-void adicionarNo(NodeL** inicio, int valor) {
+int adicionarNo(Lista* lista, int valor) {
   NodeL* novoNo = criarNo(valor);
-  if (*inicio == NULL) {
-    *inicio = novoNo;
-  } else {
-    NodeL* temp = *inicio;
-    while (temp->prox != NULL) {
-      temp = temp->prox;
-    }
-    temp->prox = novoNo;
-  }
+  if (novoNo == NULL) return -1;
+  if (lista->inicio == NULL) lista->inicio = novoNo;
+  else lista->fim->prox = novoNo;
+  lista->fim = novoNo;
+  lista->tam++;
+  return 0;
 }
 
 /**
@@ -56,105 +124,233 @@ void imprimirLista(NodeL* inicio) {
 }
 
 /**
- * @brief Reorganiza uma subárvore para manter a propriedade do heap.
+ * @brief Desce o elemento da posição i até o seu lugar no heap (versão bottom-up de Floyd).
  *
- * @param vetor O array de nós a ser reorganizado.
- * @param n O tamanho do array.
- * @param i O índice do nó que será ajustado.
+ * Primeiro desce até uma folha sempre pelo maior filho, sem comparar com o elemento,
+ * e depois sobe até a posição correta: gasta quase metade das comparações do heapify comum.
+ *
+ * @param vetor O vetor que guarda o heap.
+ * @param n O tamanho do heap.
+ * @param i O índice do elemento que será ajustado.
  */
-void heapify(NodeL** vetor, int n, int i) {
-  int maior = i;
-  int esquerda = 2 * i + 1;
-  int direita = 2 * i + 2;
+static void peneira(int* vetor, int n, int i) {
+  int valor = vetor[i], j = i, filho;
+  while ((filho = 2 * j + 1) < n) {
+    if (filho + 1 < n && vetor[filho + 1] > vetor[filho]) filho++;
+    vetor[j] = vetor[filho];
+    j = filho;
+  }
+  while (j > i && vetor[(j - 1) / 2] < valor) {
+    vetor[j] = vetor[(j - 1) / 2];
+    j = (j - 1) / 2;
+  }
+  vetor[j] = valor;
+}
 
-  if (esquerda < n && vetor[esquerda]->info > vetor[maior]->info) maior = esquerda;
-  if (direita < n && vetor[direita]->info > vetor[maior]->info) maior = direita;
+/**
+ * @brief Ordena um vetor de inteiros com Heap Sort iterativo.
+ *
+ * @param vetor O vetor que será ordenado.
+ * @param n O tamanho do vetor.
+ */
+void heapSortVetor(int* vetor, int n) {
+  for (int i = n / 2 - 1; i >= 0; i--) peneira(vetor, n, i);
+  for (int i = n - 1; i > 0; i--) {
+    int aux = vetor[0];
+    vetor[0] = vetor[i];
+    vetor[i] = aux;
+    peneira(vetor, i, 0);
+  }
+}
 
-  if (maior != i) {
-    int temp = vetor[i]->info;
-    vetor[i]->info = vetor[maior]->info;
-    vetor[maior]->info = temp;
-    heapify(vetor, n, maior);
+/**
+ * @brief Mesma peneira de 'peneira', mas sobre ponteiros para nós (compara pelo campo info).
+ */
+static void peneiraNos(NodeL** vetor, int n, int i) {
+  NodeL* no = vetor[i];
+  int j = i, filho;
+  while ((filho = 2 * j + 1) < n) {
+    if (filho + 1 < n && vetor[filho + 1]->info > vetor[filho]->info) filho++;
+    vetor[j] = vetor[filho];
+    j = filho;
+  }
+  while (j > i && vetor[(j - 1) / 2]->info < no->info) {
+    vetor[j] = vetor[(j - 1) / 2];
+    j = (j - 1) / 2;
   }
+  vetor[j] = no;
 }
 
 /**
- * @brief Ordena uma lista encadeada usando o algoritmo Heap Sort.
+ * @brief Conta os nós de um trecho da lista.
  *
- * @param inicio O primeiro nó da lista que será ordenada.
- * @param fim O último nó da lista que será ordenada.
- * @return 0 se a ordenação for bem-sucedida ou -1 se ocorrer um erro de alocação de memória.
+ * @param inicio O primeiro nó do trecho.
+ * @param fim O último nó do trecho.
+ * @return A quantidade de nós do trecho.
  */
-int heapSort(NodeL* inicio, NodeL* fim) {
-  if (inicio == NULL || fim == NULL) return -1;
-
+static int contaTrecho(NodeL* inicio, NodeL* fim) {
   int n = 0;
   NodeL* temp = inicio;
   while (temp != fim->prox) {
     n++;
     temp = temp->prox;
   }
+  return n;
+}
 
-  NodeL** vetor = malloc(n * sizeof(NodeL*));
+/**
+ * @brief Ordena os n valores a partir de inicio copiando-os para um vetor contíguo.
+ *
+ * @return 0 se a ordenação for bem-sucedida ou -1 se ocorrer um erro de alocação de memória.
+ */
+static int ordenaValores(NodeL* inicio, int n) {
+  int* vetor = malloc(n * sizeof(int));
   if (vetor == NULL) return -1;
 
+  NodeL* temp = inicio;
+  for (int i = 0; i < n; i++, temp = temp->prox) vetor[i] = temp->info;
+
+  heapSortVetor(vetor, n);
+
   temp = inicio;
-  for (int i = 0; i < n; i++) {
-    vetor[i] = temp;
-    temp = temp->prox;
-  }
+  for (int i = 0; i < n; i++, temp = temp->prox) temp->info = vetor[i];
+
+  free(vetor);
+  return 0;
+}
+
+/**
+ * @brief Ordena os n nós a partir de *inicio reencadeando-os.
+ *
+ * @param ultimo Recebe o último nó do trecho ordenado.
+ * @return 0 se a ordenação for bem-sucedida ou -1 se ocorrer um erro de alocação de memória.
+ */
+static int reencadeiaOrdenado(NodeL** inicio, int n, NodeL** ultimo) {
+  NodeL** vetor = malloc(n * sizeof(NodeL*));
+  if (vetor == NULL) return -1;
 
-  for (int i = n / 2 - 1; i >= 0; i--) heapify(vetor, n, i);
-  for (int i = n - 1; i >= 0; i--) {
-    int aux = vetor[0]->info;
-    vetor[0]->info = vetor[i]->info;
-    vetor[i]->info = aux;
-    heapify(vetor, i, 0);
+  NodeL* temp = *inicio;
+  for (int i = 0; i < n; i++, temp = temp->prox) vetor[i] = temp;
+  NodeL* depois = temp;
+
+  for (int i = n / 2 - 1; i >= 0; i--) peneiraNos(vetor, n, i);
+  for (int i = n - 1; i > 0; i--) {
+    NodeL* aux = vetor[0];
+    vetor[0] = vetor[i];
+    vetor[i] = aux;
+    peneiraNos(vetor, i, 0);
   }
 
+  for (int i = 0; i < n - 1; i++) vetor[i]->prox = vetor[i + 1];
+  vetor[n - 1]->prox = depois;
+  *inicio = vetor[0];
+  *ultimo = vetor[n - 1];
+
   free(vetor);
   return 0;
 }
 
 /**
- * @brief Retorna o último nó da lista encadeada.
+ * @brief Ordena uma lista encadeada usando o algoritmo Heap Sort.
  *
- * @param inicio O primeiro nó da lista.
- * @return O último nó da lista.
+ * Os valores são copiados para um vetor contíguo, ordenados ali e escritos de volta em uma passada.
+ *
+ * @param inicio O primeiro nó da lista que será ordenada.
+ * @param fim O último nó da lista que será ordenada.
+ * @return 0 se a ordenação for bem-sucedida ou -1 se ocorrer um erro de alocação de memória.
  */
-NodeL* obterUltimoNo(NodeL* inicio) {
-  NodeL* temp = inicio;
-  while (temp->prox != NULL) {
-    temp = temp->prox;
-  }
-  return temp;
+int heapSort(NodeL* inicio, NodeL* fim) {
+  if (inicio == NULL || fim == NULL) return -1;
+  return ordenaValores(inicio, contaTrecho(inicio, fim));
+}
+
+/**
+ * @brief Ordena a lista inteira; o tamanho vem do descritor, sem percorrer a lista para contar.
+ *
+ * @param lista A lista que será ordenada.
+ * @return 0 se a ordenação for bem-sucedida ou -1 se a lista estiver vazia ou faltar memória.
+ */
+int heapSortLista(Lista* lista) {
+  if (lista == NULL || lista->tam == 0) return -1;
+  return ordenaValores(lista->inicio, lista->tam);
+}
+
+/**
+ * @brief Ordena um trecho da lista reencadeando os nós em vez de copiar os valores.
+ *
+ * Útil quando o nó carrega dados grandes: nenhum dado é movido, só os ponteiros 'prox'.
+ *
+ * @param inicio Endereço do ponteiro que aponta para o primeiro nó do trecho
+ *               (o início da lista ou o campo 'prox' do nó anterior); passa a apontar para o menor nó.
+ * @param fim O último nó do trecho; o trecho ordenado continua ligado ao que vinha depois dele.
+ * @return 0 se a ordenação for bem-sucedida ou -1 se ocorrer um erro de alocação de memória.
+ */
+int heapSortReencadeia(NodeL** inicio, NodeL* fim) {
+  if (inicio == NULL || *inicio == NULL || fim == NULL) return -1;
+  NodeL* ultimo;
+  return reencadeiaOrdenado(inicio, contaTrecho(*inicio, fim), &ultimo);
+}
+
+/**
+ * @brief Ordena a lista inteira reencadeando os nós, mantendo o início e o fim do descritor.
+ *
+ * @param lista A lista que será ordenada.
+ * @return 0 se a ordenação for bem-sucedida ou -1 se a lista estiver vazia ou faltar memória.
+ */
+int heapSortListaReencadeia(Lista* lista) {
+  if (lista == NULL || lista->tam == 0) return -1;
+  return reencadeiaOrdenado(&lista->inicio, lista->tam, &lista->fim);
+}
+
+/**
+ * @brief Retorna o último nó da lista encadeada em O(1).
+ *
+ * @param lista A lista.
+ * @return O último nó da lista (NULL se ela estiver vazia).
+ */
+NodeL* obterUltimoNo(Lista* lista) {
+  return lista->fim;
 }
 
 int main() {
-  NodeL* lista = NULL;
+  Lista* lista = listaCria();
+  if (lista == NULL) return 1;
 
   // Adicionando elementos à lista
-  adicionarNo(&lista, 5);
-  adicionarNo(&lista, 3);
-  adicionarNo(&lista, 8);
-  adicionarNo(&lista, 1);
-  adicionarNo(&lista, 7);
+  adicionarNo(lista, 5);
+  adicionarNo(lista, 3);
+  adicionarNo(lista, 8);
+  adicionarNo(lista, 1);
+  adicionarNo(lista, 7);
 
   printf("Lista antes da ordenação:\n");
-  imprimirLista(lista);
+  imprimirLista(lista->inicio);
 
   NodeL* ultimoNo = obterUltimoNo(lista);
-  heapSort(lista, ultimoNo);
+  heapSort(lista->inicio, ultimoNo);
 
   printf("Lista após a ordenação:\n");
-  imprimirLista(lista);
+  imprimirLista(lista->inicio);
 
-  NodeL* temp;
-  while (lista != NULL) {
-    temp = lista;
-    lista = lista->prox;
-    free(temp);
-  }
+  adicionarNo(lista, 4);
+  adicionarNo(lista, 2);
+  adicionarNo(lista, 6);
+  heapSortListaReencadeia(lista);
+
+  printf("Lista após novos elementos e ordenação por reencadeamento:\n");
+  imprimirLista(lista->inicio);
+  lista = listaLibera(lista);
+
+  // Construção em bloco a partir de um vetor
+  int valores[] = {9, 4, 7, 1, 8, 2};
+  lista = listaDeVetor(valores, 6);
+  if (lista == NULL) return 1;
+  adicionarNo(lista, 0);
+  heapSortLista(lista);
+
+  printf("Lista criada de um vetor e ordenada:\n");
+  imprimirLista(lista->inicio);
+  lista = listaLibera(lista);
 
   return 0;
 }